@@ -0,0 +1,175 @@
+#ifndef AWAITABLE_HPP
+#define AWAITABLE_HPP
+//! @file awaitable.hpp
+//! @brief header only C++20 coroutine adapters for APIs taking *short_function* completion callbacks.
+//!
+//! a *short_function* can not capture the awaiting coroutine, so the adapters find it by other means; neither allocates:
+//! - 'await_context_callback' is for APIs that hand back a user pointer ('void(void *, result)' callbacks, C style APIs via
+//!   *to_ptr()*): the pointer is the awaiter itself, which lives in the coroutine frame.
+//! - 'await_callback' is for APIs taking a plain 'short_function<void(result)>': awaiters wait in a per-thread intrusive
+//!   FIFO private to the initiating function type, and each completion wakes the oldest one. such an API must complete on
+//!   the awaiting thread and in the order the operations were started.
+//! 'run_loop' is a minimal single-threaded executor whose queue stores resume handles as a *short_function* plus a context
+//! pointer, and 'task<type>' a lazily started coroutine type to go with it. a context callback may complete on another
+//! thread; the awaiting coroutine then resumes on that thread, and must not touch the loop until it is back on its own.
+//!
+//! Example:
+//! @code
+//!	task<std::size_t> echo(run_loop &loop, int fd) {
+//!		auto const n = co_await await_context_callback<std::size_t>(
+//!			[](int fd, short_function<void(void *, std::size_t)> done, void *ctx) { c_api_read(fd, done.to_ptr(), ctx); }, fd);
+//!		co_await loop.schedule();	// yield to other work
+//!		co_return n;
+//!	};
+//!	run_loop loop;
+//!	auto const n = sync_wait(loop, echo(loop, fd));
+//! @endcode
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include "short_function.hpp"
+
+namespace lib_fm {
+
+#	include "detail/d_awaitable.hpp"
+
+	//! @brief a single-threaded executor running posted work items in FIFO order
+	class run_loop {
+	public:
+		typedef short_function<void(void *)> work_function;
+
+		//! @brief queues **fn** to be called with **context**
+		void post(work_function const fn, void *const context = nullptr) { pending.push_back({ fn, context }); };
+
+		//! @brief queues the resumption of **handle**
+		void post(std::coroutine_handle<> const handle)
+		{	post([](void *address) { std::coroutine_handle<>::from_address(address).resume(); }, handle.address());	};
+
+		//! @brief an awaitable that suspends the current coroutine and queues its resumption
+		auto schedule() noexcept {
+			struct awaiter {
+				run_loop &loop;
+				bool await_ready() const noexcept { return false; };
+				void await_suspend(std::coroutine_handle<> const handle) const { loop.post(handle); };
+				void await_resume() const noexcept {};
+			};
+			return awaiter { *this };
+		}; // !schedule
+
+		//! @brief runs the work queued so far, but not the work it queues in turn
+		//! @return the number of work items run
+		std::size_t run_once() {
+			running.swap(pending);		// both vectors keep their capacity: no allocation in the steady state
+			for ( auto const &[fn, context] : running )
+				fn(context);
+			std::size_t const count = running.size();
+			running.clear();
+			return count;
+		}; // !run_once
+
+		//! @brief runs work until the queue is empty
+		void run() { while ( run_once() ); };
+
+		bool empty() const noexcept { return pending.empty(); };
+
+	private:
+		struct work_item { work_function fn; void *context; };
+		std::vector<work_item> pending, running;
+	}; // !run_loop
+
+	//! @brief a lazily started coroutine producing a **type**; resumes its awaiter by symmetric transfer on completion.
+	template<typename type = void>
+	class task {
+	public:
+		struct promise_type:
+			detail::task_result<type> {
+			task get_return_object() noexcept { return task { std::coroutine_handle<promise_type>::from_promise(*this) }; };
+			std::suspend_always initial_suspend() const noexcept { return {}; };
+			auto final_suspend() const noexcept {
+				struct awaiter {
+					bool await_ready() const noexcept { return false; };
+					std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> const self) const noexcept {
+						auto const next = self.promise().continuation;
+						self.promise().finished.store(true, std::memory_order_release);	// the frame may be gone past this
+						return next ? next : std::noop_coroutine();
+					};
+					void await_resume() const noexcept {};
+				};
+				return awaiter {};
+			}; // !final_suspend
+
+			std::coroutine_handle<> continuation;
+			std::atomic<bool> finished { false };		// set on any thread, read by sync_wait
+		}; // !promise_type
+
+		task(task &&other) noexcept: handle { std::exchange(other.handle, nullptr) } {};
+		task &operator=(task other) noexcept { std::swap(handle, other.handle); return *this; };
+		~task() { if ( handle ) handle.destroy(); };
+
+		//! @brief starts the task and suspends the awaiter until it completes
+		auto operator co_await() && noexcept {
+			struct awaiter {
+				std::coroutine_handle<promise_type> handle;
+				bool await_ready() const noexcept { return !handle || handle.done(); };
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<> const awaiting) const noexcept {
+					handle.promise().continuation = awaiting;
+					return handle;
+				};
+				type await_resume() const { return handle.promise().result(); };
+			};
+			return awaiter { handle };
+		}; // !operator co_await
+
+		bool done() const noexcept { return !handle || handle.done(); };
+
+	private:
+		template<typename result_type>
+		friend result_type sync_wait(run_loop &, task<result_type>);
+
+		explicit task(std::coroutine_handle<promise_type> const h) noexcept: handle { h } {};
+		std::coroutine_handle<promise_type> handle;
+	}; // !task
+
+	//! @brief starts **work** on **loop** and runs the loop until the task completes; while the loop is idle and the task
+	//! waits on a completion from another thread, yields the thread.
+	//! @return the result of the task; rethrows its exception
+	template<typename result_type>
+	result_type sync_wait(run_loop &loop, task<result_type> work) {
+		loop.post(work.handle);
+		while ( !work.handle.promise().finished.load(std::memory_order_acquire) )
+			if ( !loop.run_once() )
+				std::this_thread::yield();
+		return work.handle.promise().result();
+	}; // !sync_wait
+
+	//! @brief awaits an API that completes through a 'short_function<void(void *, result_type)>' and the context pointer it was given.
+	//! @tparam result_type the completion value; may be void, for 'void(void *)' callbacks
+	//! @param initiate an empty callable starting the operation: invoked as **initiate**(**args**..., callback, context)
+	//! @param args... leading arguments to **initiate**, stored in the awaiter
+	template<typename result_type, typename initiator_type, typename ... args_t>
+		requires trivial_empty<initiator_type>
+	auto await_context_callback(initiator_type, args_t&& ... args) {
+		return detail::context_awaiter<result_type, initiator_type, std::decay_t<args_t>...>
+			{ std::forward<args_t>(args)... };
+	}; // !await_context_callback
+
+	//! @brief awaits an API that completes through a plain 'short_function<void(result_type)>'.
+	//! the API must complete on the awaiting thread, in the order the operations were started.
+	//! @tparam result_type the completion value; may be void, for 'void()' callbacks
+	//! @param initiate an empty callable starting the operation: invoked as **initiate**(**args**..., callback)
+	//! @param args... leading arguments to **initiate**, stored in the awaiter
+	template<typename result_type, typename initiator_type, typename ... args_t>
+		requires trivial_empty<initiator_type>
+	auto await_callback(initiator_type, args_t&& ... args) {
+		return detail::fifo_awaiter<result_type, initiator_type, std::decay_t<args_t>...>
+			{ std::forward<args_t>(args)... };
+	}; // !await_callback
+
+}; // !lib_fm
+
+#endif // !AWAITABLE_HPP
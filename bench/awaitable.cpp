@@ -0,0 +1,84 @@
+// awaitable.cpp : ns per co_await of await_context_callback and await_callback on a run_loop, against the same chain of
+// asynchronous operations written as plain short_function callbacks, and the awaits that complete inline.
+// usage: awaitable [operations]	(default: 10000000)
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+#include "../awaitable.hpp"
+#include "bench.hpp"
+using namespace lib_fm;
+
+typedef short_function<void(void *, std::uint64_t)> context_callback;
+typedef short_function<void(std::uint64_t)> plain_callback;
+
+//! the asynchronous API: adds one and completes from the loop. a chain has one operation in flight, so one record will do
+run_loop loop;
+struct operation { context_callback context_done; plain_callback plain_done; void *context; std::uint64_t value; } pending;
+
+void async_add(std::uint64_t const x, context_callback const done, void *const context) {
+	pending = { done, {}, context, x + 1 };
+	loop.post([](void *p) { auto const op = static_cast<operation *>(p); op->context_done(op->context, op->value); }, &pending);
+};
+void async_add(std::uint64_t const x, plain_callback const done) {
+	pending = { {}, done, nullptr, x + 1 };
+	loop.post([](void *p) { auto const op = static_cast<operation *>(p); op->plain_done(op->value); }, &pending);
+};
+void inline_add(std::uint64_t const x, context_callback const done, void *const context) { done(context, x + 1); };
+
+//! the form the adapters replace: every step is a callback that starts the next operation
+struct chain { std::size_t remaining; std::uint64_t value; };
+void step(void *const context, std::uint64_t const value) {
+	auto &c = *static_cast<chain *>(context);
+	c.value = value;
+	if ( --c.remaining )
+		async_add(value, monostate_from<&step>, context);
+};
+
+task<std::uint64_t> context_chain(std::size_t const count) {
+	std::uint64_t value = 0;
+	for ( std::size_t i = 0; i < count; ++i )
+		value = co_await await_context_callback<std::uint64_t>([](std::uint64_t x, context_callback done, void *c) { async_add(x, done, c); }, value);
+	co_return value;
+};
+task<std::uint64_t> fifo_chain(std::size_t const count) {
+	std::uint64_t value = 0;
+	for ( std::size_t i = 0; i < count; ++i )
+		value = co_await await_callback<std::uint64_t>([](std::uint64_t x, plain_callback done) { async_add(x, done); }, value);
+	co_return value;
+};
+task<std::uint64_t> inline_chain(std::size_t const count) {
+	std::uint64_t value = 0;
+	for ( std::size_t i = 0; i < count; ++i )
+		value = co_await await_context_callback<std::uint64_t>([](std::uint64_t x, context_callback done, void *c) { inline_add(x, done, c); }, value);
+	co_return value;
+};
+
+template<typename work_type>
+void report(std::string_view const name, std::size_t const count, work_type work) {
+	std::uint64_t value = 0;
+	auto const time = seconds([&] { value = work(); });
+	if ( value != count ) {
+		std::cerr << name << ": wrong result\n";
+		std::exit(EXIT_FAILURE);
+	};
+	std::cout << "  " << name << ": " << time / static_cast<double>(count) * 1e9 << " ns/operation\n";
+};
+
+int main(int const argc, char const *const argv[]) {
+	std::size_t const count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+
+	std::cout << "completed from the run_loop:\n";
+	report("short_function callbacks", count, [count] {
+		chain c { count, 0 };
+		async_add(0, monostate_from<&step>, &c);
+		loop.run();
+		return c.value;
+	});
+	report("await_context_callback", count, [count] { return sync_wait(loop, context_chain(count)); });
+	report("await_callback", count, [count] { return sync_wait(loop, fifo_chain(count)); });
+
+	std::cout << "completed inline, without suspending:\n";
+	report("await_context_callback", count, [count] { return sync_wait(loop, inline_chain(count)); });
+	return EXIT_SUCCESS;
+};
@@ -0,0 +1,16 @@
+#ifndef BENCH_HPP
+#define BENCH_HPP
+//! @file bench.hpp
+//! @brief helpers shared by the benchmarks in this directory.
+
+#include <chrono>
+
+//! @brief wall time of one call to **work**, in seconds
+template<typename work_type>
+double seconds(work_type &&work) {
+	auto const start = std::chrono::steady_clock::now();
+	work();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+};
+
+#endif // !BENCH_HPP
@@ -0,0 +1,119 @@
+// call_queue.cpp : calls/s through spsc and mpmc call queues of deferred_call, against the same queues carrying
+// std::function<void()> closures, and against a mutex-guarded std::deque of closures.
+// usage: call_queue [calls]	(default: 10000000)
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "../call_queue.hpp"
+#include "bench.hpp"
+using namespace lib_fm;
+
+std::uint64_t total = 0;
+void add(std::uint64_t const value, std::uint64_t const scale) { total += value * scale; };
+
+//! @brief a mutex and a deque: the queue most code reaches for first.
+template<typename T>
+struct locked_queue {
+	bool try_push(T &&value) {
+		std::lock_guard const lock { mutex };
+		values.push_back(std::move(value));
+		return true;
+	};
+	std::optional<T> try_pop() {
+		std::lock_guard const lock { mutex };
+		if ( values.empty() )
+			return std::nullopt;
+		std::optional<T> result { std::move(values.front()) };
+		values.pop_front();
+		return result;
+	};
+
+	std::mutex mutex;
+	std::deque<T> values;
+}; // !locked_queue
+
+//! @brief the same workload as a closure: two captured words, which fits std::function's small buffer.
+std::function<void()> closure(std::uint64_t const value) {
+	return [value] { add(value, 3); };
+};
+deferred_call<void(std::uint64_t, std::uint64_t)> call(std::uint64_t const value) {
+	return { monostate_from<&add>, value, 3 };
+};
+
+//! @brief one producer and one consumer thread; the consumer invokes every element it pops.
+template<typename queue_type, typename make_type>
+void threaded(std::string_view const name, std::size_t const count, make_type make) {
+	auto queue = std::make_unique<queue_type>();
+	total = 0;
+	auto const time = seconds([&] {
+		std::thread producer { [&] {
+			for ( std::size_t i = 0; i < count; ++i )
+				while ( !queue->try_push(make(i)) )
+					std::this_thread::yield();
+		} };
+		for ( std::size_t popped = 0; popped < count; )
+			if ( auto element = queue->try_pop() ) {
+				(*element)();
+				++popped;
+			} else
+				std::this_thread::yield();
+		producer.join();
+	});
+	if ( total != 3 * (count * (count - 1) / 2) ) {
+		std::cerr << name << ": wrong total\n";
+		std::exit(EXIT_FAILURE);
+	};
+	std::cout << "  " << name << ": " << count / time / 1e6 << " M calls/s\n";
+};
+
+//! @brief one thread, batches of 64 through try_push_n/try_pop_n: the queue cost without any scheduling noise.
+template<typename queue_type, typename make_type>
+void batched(std::string_view const name, std::size_t const count, make_type make) {
+	using element_type = decltype(make(0));
+	auto queue = std::make_unique<queue_type>();
+	std::vector<element_type> batch;
+	batch.reserve(64);
+	total = 0;
+	auto const time = seconds([&] {
+		for ( std::size_t next = 0; next < count; ) {
+			batch.clear();
+			for ( std::size_t i = next; i < next + 64 && i < count; ++i )
+				batch.push_back(make(i));
+			next += queue->try_push_n(std::make_move_iterator(batch.begin()), batch.size());
+			queue->try_pop_n(64, [](element_type &&element) { element(); });
+		};
+	});
+	if ( total != 3 * (count * (count - 1) / 2) ) {
+		std::cerr << name << ": wrong total\n";
+		std::exit(EXIT_FAILURE);
+	};
+	std::cout << "  " << name << ": " << count / time / 1e6 << " M calls/s\n";
+};
+
+int main(int const argc, char const *const argv[]) {
+	std::size_t const count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+	typedef deferred_call<void(std::uint64_t, std::uint64_t)> call_type;
+	typedef std::function<void()> closure_type;
+	std::cout << "sizeof deferred_call: " << sizeof(call_type) << ", sizeof std::function: " << sizeof(closure_type) << "\n";
+
+	std::cout << "producer + consumer thread, one element per push/pop:\n";
+	threaded<spsc_queue<call_type, 1024>>("spsc deferred_call", count, call);
+	threaded<spsc_queue<closure_type, 1024>>("spsc std::function", count, closure);
+	threaded<mpmc_queue<call_type, 1024>>("mpmc deferred_call", count, call);
+	threaded<mpmc_queue<closure_type, 1024>>("mpmc std::function", count, closure);
+	threaded<locked_queue<closure_type>>("mutex + deque std::function", count, closure);
+
+	std::cout << "single thread, batches of 64:\n";
+	batched<spsc_queue<call_type, 1024>>("spsc deferred_call", count, call);
+	batched<spsc_queue<closure_type, 1024>>("spsc std::function", count, closure);
+	batched<mpmc_queue<call_type, 1024>>("mpmc deferred_call", count, call);
+	batched<mpmc_queue<closure_type, 1024>>("mpmc std::function", count, closure);
+	return EXIT_SUCCESS;
+};
@@ -0,0 +1,30 @@
+#!/bin/sh
+# compile-time benchmark: generates one translation unit that instantiates short_function for N distinct signatures, each
+# initialized from its own lambda and called once, then compiles it at -O0 and -O2 and reports wall time and object size.
+# to compare revisions, run the script from a checkout of each.
+# usage: bench/compile_time.sh [signatures]	(default: 1000; CXX and CXXFLAGS are honoured)
+set -e
+cd "$(dirname "$0")"
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:-"-std=c++20"}
+count=${1:-1000}
+mkdir -p build
+
+source=build/compile_time_$count.cpp
+{
+	echo '#include "short_function.hpp"'
+	echo 'template<int> struct tag { int value; };'
+	i=0
+	while [ $i -lt "$count" ]; do
+		echo "int use$i() { lib_fm::short_function<int(tag<$i>)> const f { [](tag<$i> t) { return t.value + $i; } }; return f(tag<$i> { 1 }); }"
+		i=$((i + 1))
+	done
+} > $source
+
+echo "== compile_time ($count signatures, $($CXX --version | head -n 1))"
+for level in -O0 -O2; do
+	start=$(date +%s%N)
+	$CXX $CXXFLAGS $level -I.. -c $source -o build/compile_time.o
+	end=$(date +%s%N)
+	echo "$level: $(( (end - start) / 1000000 )) ms, $(wc -c < build/compile_time.o) object bytes"
+done
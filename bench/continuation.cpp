@@ -0,0 +1,100 @@
+// continuation.cpp : trampoline chains of 10 to 10^6 stages against the same chains as nested calls; time per stage and
+// stack used. the nested chains run on a thread with a large stack.
+// usage: continuation [longest chain]	(default: 1000000)
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <pthread.h>
+#include "../continuation.hpp"
+#include "bench.hpp"
+using namespace lib_fm;
+
+struct chain {
+	std::size_t remaining;
+	std::size_t stages = 0;
+	std::uintptr_t top = 0, lowest = ~std::uintptr_t {};
+
+	void visit() noexcept {
+		char marker;
+		lowest = std::min(lowest, reinterpret_cast<std::uintptr_t>(&marker));
+		++stages;
+	};
+	std::size_t stack_bytes() const noexcept { return top - lowest; };
+}; // !chain
+
+//! the portable form: hand the successor to the trampoline and return
+void trampolined(trampoline<chain> &t) {
+	t.state().visit();
+	if ( --t.state().remaining )
+		t.then(monostate_from<&trampolined>);
+};
+
+//! the form it replaces: each stage calls the next one itself. not a tail call: the stage has work left after it returns
+short_function<void(chain &)> next_nested;
+std::size_t unwound = 0;
+void nested(chain &c) {
+	c.visit();
+	if ( --c.remaining )
+		next_nested(c);
+	++unwound;
+};
+
+struct result { double seconds; std::size_t stages, stack_bytes; };
+
+template<bool use_trampoline>
+result run_chains(std::size_t const length, std::size_t const repeats) {
+	result r { 0, 0, 0 };
+	char marker;
+	for ( std::size_t i = 0; i < repeats; ++i ) {
+		chain c { length };
+		c.top = reinterpret_cast<std::uintptr_t>(&marker);
+		r.seconds += seconds([&c] {
+			if constexpr ( use_trampoline )
+				trampoline<chain> { c }.run(monostate_from<&trampolined>);
+			else
+				nested(c);
+		});
+		r.stages += c.stages;
+		r.stack_bytes = std::max(r.stack_bytes, c.stack_bytes());
+	};
+	return r;
+};
+
+struct job { std::size_t length, repeats; result outcome; };
+
+void *run_nested(void *const argument) {
+	auto &j = *static_cast<job *>(argument);
+	j.outcome = run_chains<false>(j.length, j.repeats);
+	return nullptr;
+};
+
+int main(int const argc, char const *const argv[]) {
+	std::size_t const longest = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000;
+	next_nested = monostate_from<&nested>;
+
+	pthread_attr_t attributes;
+	pthread_attr_init(&attributes);
+	pthread_attr_setstacksize(&attributes, std::size_t { 1 } << 30);	// room for 10^6 nested frames
+
+	for ( std::size_t length = 10; length <= longest; length *= 10 ) {
+		std::size_t const repeats = std::max<std::size_t>(1, 10'000'000 / length);
+		auto const flat = run_chains<true>(length, repeats);
+
+		job deep { length, repeats, {} };
+		pthread_t thread;
+		if ( pthread_create(&thread, &attributes, &run_nested, &deep) || pthread_join(thread, nullptr) ) {
+			std::cerr << "continuation: can't start the nested run\n";
+			return EXIT_FAILURE;
+		};
+		if ( flat.stages != length * repeats || deep.outcome.stages != flat.stages ) {
+			std::cerr << "continuation: stage counts differ\n";
+			return EXIT_FAILURE;
+		};
+		std::cout << length << " stages: trampoline " << 1e9 * flat.seconds / flat.stages << " ns/stage, "
+			<< flat.stack_bytes << " stack bytes; nested " << 1e9 * deep.outcome.seconds / deep.outcome.stages << " ns/stage, "
+			<< deep.outcome.stack_bytes << " stack bytes\n";
+	};
+	pthread_attr_destroy(&attributes);
+	return unwound ? EXIT_SUCCESS : EXIT_FAILURE;
+};
@@ -0,0 +1,61 @@
+// memoized.cpp : aggregate lookups/s of a memoized function from 1 to 32 threads, for both eviction policies.
+// usage: memoized [lookups per thread]	(default: 1000000)
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "../memoized.hpp"
+#include "bench.hpp"
+using namespace lib_fm;
+
+//! @brief about two microseconds of pure work, so a hit is clearly cheaper than a miss
+std::uint64_t digest(std::uint64_t x) {
+	for ( int i = 0; i < 1024; ++i )
+		x = (x ^ (x >> 31)) * 0x7fb5d329728ea185ull;
+	return x;
+};
+
+//! keys are drawn from twice the capacity, with a skew towards small keys: about 60% of lookups hit
+template<memo_eviction policy>
+void run(std::string_view const name, std::size_t const lookups) {
+	std::size_t constexpr capacity = 1 << 14;
+	auto const f = memoized<&digest, policy, capacity, 64>;
+	std::cout << name << ":\n";
+	for ( unsigned threads = 1; threads <= 32; threads *= 2 ) {
+		f.clear();
+		auto const before = f.statistics();
+		std::vector<std::thread> pool;
+		std::atomic<std::uint64_t> sink { 0 };
+		auto const time = seconds([&] {
+			for ( unsigned t = 0; t < threads; ++t )
+				pool.emplace_back([&, t] {
+					std::mt19937_64 random { t };
+					std::geometric_distribution<std::uint64_t> key { 1.0 / capacity };
+					std::uint64_t local = 0;
+					for ( std::size_t i = 0; i < lookups; ++i )
+						local += f(key(random) % (2 * capacity));
+					sink.fetch_add(local, std::memory_order_relaxed);
+				});
+			for ( auto &thread : pool )
+				thread.join();
+		});
+		auto const after = f.statistics();
+		auto const hits = after.hits - before.hits, misses = after.misses - before.misses;
+		std::cout << "  " << threads << " threads: " << threads * lookups / time / 1e6 << " M lookups/s, "
+			<< 100.0 * hits / (hits + misses) << "% hits\n";
+	};
+};
+
+int main(int const argc, char const *const argv[]) {
+	std::size_t const lookups = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000;
+	std::cout << "unmemoized digest: " << lookups / seconds([&] {
+		std::uint64_t volatile sink = 0;
+		for ( std::size_t i = 0; i < lookups; ++i )
+			sink = sink + digest(i);
+	}) / 1e6 << " M calls/s on one thread\n";
+	run<memo_eviction::lru>("lru", lookups);
+	run<memo_eviction::clock>("clock", lookups);
+	return EXIT_SUCCESS;
+};
@@ -0,0 +1,73 @@
+// message_dispatcher.cpp : messages/s through message_dispatcher, alone and as a full encode -> dispatch -> decode loopback.
+// usage: message_dispatcher [messages]	(default: 10000000)
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <string_view>
+#include "../message_dispatcher.hpp"
+#include "bench.hpp"
+using namespace lib_fm;
+
+struct service {
+	std::uint64_t add(std::uint64_t const a, std::uint64_t const b) const { return a + b; };
+	std::string_view echo(std::string_view const text) const { return text; };
+	std::uint64_t sum(std::span<std::uint32_t const> const values) const { return std::accumulate(values.begin(), values.end(), std::uint64_t {}); };
+}; // !service
+
+enum : std::uint32_t { add_id, echo_id, sum_id };
+
+int main(int const argc, char const *const argv[]) {
+	std::size_t const count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+	service object;
+	message_dispatcher<service> dispatcher { object };
+	dispatcher.add(add_id, monostate_from<&service::add>);
+	dispatcher.add(echo_id, monostate_from<&service::echo>);
+	dispatcher.add(sum_id, monostate_from<&service::sum>);
+
+	alignas(8) std::array<std::byte, 256> request;
+	alignas(8) std::array<std::byte, 256> response;
+	std::uint32_t const values[16] { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+	std::uint64_t check = 0;
+
+	auto const report = [count](std::string_view const name, double const time)
+	{	std::cout << "  " << name << ": " << count / time / 1e6 << " M messages/s\n";	};
+
+	std::cout << "dispatch only, request encoded once:\n";
+	auto const add_size = *encode_request<&service::add>(request, std::uint64_t { 40 }, std::uint64_t { 2 });
+	report("add(u64, u64)", seconds([&] {
+		for ( std::size_t i = 0; i < count; ++i )
+			check += dispatcher.dispatch(add_id, std::span { request }.first(add_size), response).written;
+	}));
+
+	std::cout << "loopback, encode -> dispatch -> decode:\n";
+	report("add(u64, u64)", seconds([&] {
+		for ( std::size_t i = 0; i < count; ++i ) {
+			auto const size = encode_request<&service::add>(request, std::uint64_t { i }, std::uint64_t { 1 });
+			auto const [status, written] = dispatcher.dispatch(add_id, std::span { request }.first(*size), response);
+			check += *decode_response<&service::add>(std::span { response }.first(written));
+		};
+	}));
+	report("echo(string_view), 32 chars", seconds([&] {
+		std::string_view const text { "a 32 character string view input" };
+		for ( std::size_t i = 0; i < count; ++i ) {
+			auto const size = encode_request<&service::echo>(request, text);
+			auto const [status, written] = dispatcher.dispatch(echo_id, std::span { request }.first(*size), response);
+			check += decode_response<&service::echo>(std::span { response }.first(written))->size();
+		};
+	}));
+	report("sum(span<u32 const>), 16 elements", seconds([&] {
+		for ( std::size_t i = 0; i < count; ++i ) {
+			auto const size = encode_request<&service::sum>(request, std::span<std::uint32_t const> { values });
+			auto const [status, written] = dispatcher.dispatch(sum_id, std::span { request }.first(*size), response);
+			check += *decode_response<&service::sum>(std::span { response }.first(written));
+		};
+	}));
+
+	std::uint64_t const expected = count * 8 + count * (count - 1) / 2 + count + count * 32 + count * 136;
+	if ( check != expected ) {
+		std::cerr << "message_dispatcher: wrong results\n";
+		return EXIT_FAILURE;
+	};
+	return EXIT_SUCCESS;
+};
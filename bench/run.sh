@@ -0,0 +1,22 @@
+#!/bin/sh
+# builds every benchmark in this directory with the host compiler and runs it with its default arguments; then once more
+# per "// build variant: FLAGS" line in its source, with FLAGS added.
+# usage: bench/run.sh [benchmark names...]	(CXX and CXXFLAGS are honoured)
+set -e
+cd "$(dirname "$0")"
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:-"-std=c++20 -O2 -DNDEBUG -pthread"}
+mkdir -p build
+if [ $# -eq 0 ]; then
+	set -- $(ls *.cpp | sed 's/\.cpp$//')
+fi
+for name in "$@"; do
+	$CXX $CXXFLAGS -I.. "$name.cpp" -o "build/$name" -ldl
+	echo "== $name"
+	"./build/$name"
+	tr -d '\r' < "$name.cpp" | sed -n 's|^// build variant: ||p' | while read -r flags; do
+		$CXX $CXXFLAGS $flags -I.. "$name.cpp" -o "build/$name" -ldl
+		echo "== $name ($flags)"
+		"./build/$name"
+	done
+done
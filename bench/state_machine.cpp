@@ -0,0 +1,147 @@
+// state_machine.cpp : events/s of the dense state_machine table against a hand-written switch and against a table of
+// std::function actions, on the same key=value line machine and the same random event stream.
+// usage: state_machine [events]	(default: 20000000)
+#include <array>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+#include "../state_machine.hpp"
+#include "../monostate_from.hpp"
+#include "bench.hpp"
+using namespace lib_fm;
+
+enum class state { idle, key, value, comment, count };
+enum class input { letter, digit, equals, newline, hash, count };
+
+struct counters {
+	void on_key_char() { ++key_chars; };
+	void on_equals() { ++pairs; };
+	void on_value_char() { ++value_chars; };
+	void on_line() { ++lines; };
+	void on_comment() { ++comments; };
+
+	bool operator==(counters const &) const = default;
+	std::uint64_t key_chars = 0, pairs = 0, value_chars = 0, lines = 0, comments = 0;
+}; // !counters
+
+using machine = state_machine<counters, state, input,
+	transition<state::idle, input::letter, monostate_from<&counters::on_key_char>, state::key>,
+	transition<state::idle, input::hash, nullptr, state::comment>,
+	transition<state::key, input::letter, monostate_from<&counters::on_key_char>, state::key>,
+	transition<state::key, input::digit, monostate_from<&counters::on_key_char>, state::key>,
+	transition<state::key, input::equals, monostate_from<&counters::on_equals>, state::value>,
+	transition<state::value, input::letter, monostate_from<&counters::on_value_char>, state::value>,
+	transition<state::value, input::digit, monostate_from<&counters::on_value_char>, state::value>,
+	transition<state::value, input::newline, monostate_from<&counters::on_line>, state::idle>,
+	transition<state::comment, input::newline, monostate_from<&counters::on_comment>, state::idle>>;
+
+//! @brief the same machine as nested switches, the usual hand-written form
+state switch_feed(counters &c, state const s, input const e) {
+	switch ( s ) {
+	case state::idle:
+		switch ( e ) {
+		case input::letter: c.on_key_char(); return state::key;
+		case input::hash: return state::comment;
+		default: return s;
+		};
+	case state::key:
+		switch ( e ) {
+		case input::letter: case input::digit: c.on_key_char(); return state::key;
+		case input::equals: c.on_equals(); return state::value;
+		default: return s;
+		};
+	case state::value:
+		switch ( e ) {
+		case input::letter: case input::digit: c.on_value_char(); return state::value;
+		case input::newline: c.on_line(); return state::idle;
+		default: return s;
+		};
+	case state::comment:
+		if ( e == input::newline ) {
+			c.on_comment();
+			return state::idle;
+		};
+		return s;
+	default:
+		return s;
+	};
+};
+
+//! @brief the same machine as a runtime table of std::function actions
+struct function_table {
+	struct entry {
+		std::function<void(counters &)> action;
+		state next;
+	};
+
+	function_table() {
+		for ( std::size_t s = 0; s < 4; ++s )
+			for ( std::size_t e = 0; e < 5; ++e )
+				table[s * 5 + e] = { [](counters &) {}, static_cast<state>(s) };
+		auto const add = [this](state s, input e, std::function<void(counters &)> action, state next)
+		{	table[static_cast<std::size_t>(s) * 5 + static_cast<std::size_t>(e)] = { std::move(action), next };	};
+		add(state::idle, input::letter, &counters::on_key_char, state::key);
+		add(state::idle, input::hash, [](counters &) {}, state::comment);
+		add(state::key, input::letter, &counters::on_key_char, state::key);
+		add(state::key, input::digit, &counters::on_key_char, state::key);
+		add(state::key, input::equals, &counters::on_equals, state::value);
+		add(state::value, input::letter, &counters::on_value_char, state::value);
+		add(state::value, input::digit, &counters::on_value_char, state::value);
+		add(state::value, input::newline, &counters::on_line, state::idle);
+		add(state::comment, input::newline, &counters::on_comment, state::idle);
+	};
+
+	state feed(counters &c, state const s, input const e) const {
+		entry const &row = table[static_cast<std::size_t>(s) * 5 + static_cast<std::size_t>(e)];
+		row.action(c);
+		return row.next;
+	};
+
+	std::array<entry, 20> table;
+}; // !function_table
+
+void report(std::string_view const name, std::size_t const events, double const time, counters const &result, counters const &expected) {
+	if ( !(result == expected) ) {
+		std::cerr << name << ": counters differ from the state_machine run\n";
+		std::exit(EXIT_FAILURE);
+	};
+	std::cout << "  " << name << ": " << events / time / 1e6 << " M events/s\n";
+};
+
+int main(int const argc, char const *const argv[]) {
+	std::size_t const count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20'000'000;
+	std::mt19937 random { 42 };
+	std::discrete_distribution<int> pick { 50, 20, 8, 10, 2 };	// mostly characters, a few separators: branches are unpredictable
+	std::vector<input> events(count);
+	for ( auto &event : events )
+		event = static_cast<input>(pick(random));
+
+	counters expected;
+	machine fsm { expected, state::idle };
+	state last {};
+	report("state_machine", count, seconds([&] { last = fsm.feed(std::span<input const> { events }); }), expected, expected);
+
+	counters switched;
+	state s = state::idle;
+	report("switch", count, seconds([&] {
+		for ( auto const event : events )
+			s = switch_feed(switched, s, event);
+	}), switched, expected);
+
+	counters functions;
+	function_table const table;
+	state t = state::idle;
+	report("std::function table", count, seconds([&] {
+		for ( auto const event : events )
+			t = table.feed(functions, t, event);
+	}), functions, expected);
+
+	if ( s != last || t != last ) {
+		std::cerr << "final states differ\n";
+		return EXIT_FAILURE;
+	};
+	return EXIT_SUCCESS;
+};
@@ -0,0 +1,65 @@
+// timer_wheel.cpp : memory per pending timer, and schedule/cancel/expiry throughput at 1M and 10M pending timers.
+// usage: timer_wheel [pending timers...]	(default: 1000000 10000000)
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../timer_wheel.hpp"
+#include "bench.hpp"
+using namespace lib_fm;
+
+std::size_t fired_count = 0;
+void on_expiry(timer_id) { ++fired_count; };
+
+void run(std::size_t const count) {
+	typedef timer_wheel<> wheel_type;
+	wheel_type::tick_type constexpr horizon = 1 << 20;	// delays spread over ~1M ticks: every level is exercised
+
+	std::mt19937_64 random { count };
+	std::uniform_int_distribution<wheel_type::tick_type> delay { 1, horizon };
+	std::vector<wheel_type::tick_type> delays(count);
+	for ( auto &d : delays )
+		d = delay(random);
+
+	wheel_type wheel;
+	wheel.reserve(count);
+	std::vector<timer_id> ids(count);
+	fired_count = 0;
+
+	auto const schedule_time = seconds([&] {
+		for ( std::size_t i = 0; i < count; ++i )
+			ids[i] = wheel.schedule(delays[i], monostate_from<&on_expiry>);
+	});
+	auto const bytes = sizeof(wheel) + wheel.capacity() * wheel_type::bytes_per_timer;
+
+	std::size_t cancelled = 0;
+	auto const cancel_time = seconds([&] {
+		for ( std::size_t i = 0; i < count; i += 4 )
+			cancelled += wheel.cancel(ids[i]);
+	});
+
+	std::size_t fired = 0;
+	auto const expiry_time = seconds([&] { fired = wheel.advance(horizon); });
+
+	if ( fired != count - cancelled || fired != fired_count || !wheel.empty() ) {
+		std::cerr << "timer_wheel: " << fired << " fired, expected " << count - cancelled << "\n";
+		std::exit(EXIT_FAILURE);
+	};
+
+	std::cout << count << " timers: "
+		<< static_cast<double>(bytes) / count << " bytes/timer ("
+		<< wheel_type::bytes_per_timer << " per node), "
+		<< count / schedule_time / 1e6 << " M schedules/s, "
+		<< cancelled / cancel_time / 1e6 << " M cancels/s, "
+		<< fired / expiry_time / 1e6 << " M expiries/s (" << horizon << " ticks in " << expiry_time << " s)\n";
+};
+
+int main(int const argc, char const *const argv[]) {
+	if ( argc < 2 ) {
+		run(1'000'000);
+		run(10'000'000);
+	} else
+		for ( int i = 1; i < argc; ++i )
+			run(std::strtoull(argv[i], nullptr, 10));
+	return EXIT_SUCCESS;
+};
@@ -0,0 +1,49 @@
+// trace.cpp : ns per call through a short_function and a monostate_from thunk, with tracing compiled out, compiled in
+// but disabled at runtime, and enabled. LIB_FM_TRACE is per build, so bench/run.sh builds this file once more with:
+// build variant: -DLIB_FM_TRACE=1
+// usage: trace [calls]	(default: 10000000)
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+#include "../trace.hpp"
+#include "../short_function.hpp"
+#include "bench.hpp"
+using namespace lib_fm;
+
+int volatile sink = 0;
+void store(int const x) { sink = x; };
+struct counter { void add(int const x) { sink = x; }; };
+
+//! set at startup, so the calls below stay indirect
+short_function<void(int)> free_call;
+void (*member_thunk)(counter &, int) = nullptr;
+
+[[gnu::noinline]] void report(std::string_view const name, std::size_t const count) {
+	counter object;
+	double const free_time = seconds([count] {
+		for ( std::size_t i = 0; i < count; ++i )
+			free_call(static_cast<int>(i));
+	});
+	double const member_time = seconds([count, &object] {
+		for ( std::size_t i = 0; i < count; ++i )
+			member_thunk(object, static_cast<int>(i));
+	});
+	std::cout << "  " << name << ": short_function " << free_time / static_cast<double>(count) * 1e9
+		<< " ns/call, monostate_from " << member_time / static_cast<double>(count) * 1e9 << " ns/call\n";
+};
+
+int main(int const argc, char const *const argv[]) {
+	std::size_t const count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+	free_call = monostate_from<&store>;
+	member_thunk = monostate_from<&counter::add>;
+
+#if LIB_FM_TRACE
+	report("compiled in, disabled", count);
+	trace_enable();
+	report("enabled", count);
+	trace_enable(false);
+#else
+	report("compiled out", count);
+#endif
+	return EXIT_SUCCESS;
+};
@@ -0,0 +1,243 @@
+#ifndef CALL_QUEUE_HPP
+#define CALL_QUEUE_HPP
+//! @file call_queue.hpp
+//! @brief header only bounded lock-free queues for cross-thread handoff of *deferred_call*s.
+//!
+//! 'spsc_queue' and 'mpmc_queue' are fixed capacity ring buffers storing their elements inline. producer and consumer
+//! indices live on separate cache lines; 'mpmc_queue' additionally gives every cell its own cache line, with the sequence
+//! number next to the payload, so that neighbouring producers/consumers never share a line. both queues support batch
+//! push/pop, which amortize the index updates over many elements.
+//! 'spsc_call_queue<signature, capacity>' and 'mpmc_call_queue<signature, capacity>' hold *deferred_call*s; *run* pops and
+//! invokes them in batches.
+//!
+//! Example:
+//! @code
+//!	mpmc_call_queue<void(connection&), 1024> queue;
+//!	queue.try_emplace(monostate_from<&connection::flush>, std::ref(conn));	// any producer thread
+//!	run(queue, 64);														// any consumer thread
+//! @endcode
+
+#include <atomic>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <cstddef>
+#include "deferred_call.hpp"
+
+namespace lib_fm {
+
+#	include "detail/d_call_queue.hpp"
+
+	//! @brief size used to keep independently written data on separate cache lines
+	std::size_t constexpr inline cache_line_size = detail::cache_line_size;
+
+	//! @brief a bounded wait-free single-producer/single-consumer queue
+	//! @tparam value_type the element type
+	//! @tparam capacity number of cells; must be a power of 2
+	template<typename value_type, std::size_t capacity>
+		requires(capacity > 1 && !(capacity & (capacity - 1)))
+	class spsc_queue {
+	public:
+		spsc_queue() = default;
+		spsc_queue(spsc_queue const &) = delete;
+		spsc_queue &operator=(spsc_queue const &) = delete;
+		~spsc_queue() { while ( try_pop() ); };
+
+		//! @brief constructs an element in place. producer only.
+		//! @return **true** on success; **false**, if the queue is full.
+		template<typename ... args_t>
+		bool try_emplace(args_t&& ... args) {
+			std::size_t const tail = producer.index.load(std::memory_order_relaxed);
+			if ( tail - producer.cached == capacity ) {
+				producer.cached = consumer.index.load(std::memory_order_acquire);
+				if ( tail - producer.cached == capacity )
+					return false;
+			};
+			cells[tail & mask].construct(std::forward<args_t>(args)...);
+			producer.index.store(tail + 1, std::memory_order_release);
+			return true;
+		}; // !try_emplace
+
+		bool try_push(value_type const &value) { return try_emplace(value); };
+		bool try_push(value_type &&value) { return try_emplace(std::move(value)); };
+
+		//! @brief pushes up to **count** elements from **first**, publishing them at once. producer only.
+		//! @return the number of elements pushed
+		template<std::input_iterator iterator>
+		std::size_t try_push_n(iterator first, std::size_t count) {
+			std::size_t const tail = producer.index.load(std::memory_order_relaxed);
+			if ( capacity - (tail - producer.cached) < count )
+				producer.cached = consumer.index.load(std::memory_order_acquire);
+			count = std::min(count, capacity - (tail - producer.cached));
+			for ( std::size_t i = 0; i < count; ++i, ++first )
+				cells[(tail + i) & mask].construct(*first);
+			producer.index.store(tail + count, std::memory_order_release);
+			return count;
+		}; // !try_push_n
+
+		//! @brief removes the oldest element. consumer only.
+		//! @return the element; or a null **std::optional**, if the queue is empty.
+		std::optional<value_type> try_pop() {
+			std::optional<value_type> result;
+			try_pop_n(1, [&result](value_type &&value) { result.emplace(std::move(value)); });
+			return result;
+		}; // !try_pop
+
+		//! @brief removes up to **count** elements, passing each to **sink** in order, and releases their cells at once. consumer only.
+		//! @return the number of elements removed
+		std::size_t try_pop_n(std::size_t count, auto &&sink) {
+			std::size_t const head = consumer.index.load(std::memory_order_relaxed);
+			if ( consumer.cached - head < count )
+				consumer.cached = producer.index.load(std::memory_order_acquire);
+			count = std::min(count, consumer.cached - head);
+			for ( std::size_t i = 0; i < count; ++i )
+				cells[(head + i) & mask].consume(sink);
+			consumer.index.store(head + count, std::memory_order_release);
+			return count;
+		}; // !try_pop_n
+
+		//! @brief number of elements; exact only when called from the producer or consumer thread while the other is idle.
+		std::size_t size() const noexcept
+		{	return producer.index.load(std::memory_order_acquire) - consumer.index.load(std::memory_order_acquire);	};
+		bool empty() const noexcept { return !size(); };
+
+	private:
+		std::size_t static constexpr mask = capacity - 1;
+
+		struct alignas(cache_line_size) index_type {
+			std::atomic<std::size_t> index { 0 };
+			std::size_t cached = 0;		// last seen value of the other side's index
+		};
+
+		index_type producer;
+		index_type consumer;
+		detail::queue_cell<value_type> cells[capacity];
+	}; // !spsc_queue
+
+	//! @brief a bounded lock-free multi-producer/multi-consumer queue (sequence numbered cells).
+	//! @tparam value_type the element type
+	//! @tparam capacity number of cells; must be a power of 2
+	template<typename value_type, std::size_t capacity>
+		requires(capacity > 1 && !(capacity & (capacity - 1)))
+	class mpmc_queue {
+	public:
+		mpmc_queue() noexcept {
+			for ( std::size_t i = 0; i < capacity; ++i )
+				cells[i].sequence.store(i, std::memory_order_relaxed);
+		};
+		mpmc_queue(mpmc_queue const &) = delete;
+		mpmc_queue &operator=(mpmc_queue const &) = delete;
+		~mpmc_queue() { while ( try_pop() ); };
+
+		//! @brief constructs an element in place.
+		//! @return **true** on success; **false**, if the queue is full.
+		template<typename ... args_t>
+		bool try_emplace(args_t&& ... args) {
+			std::size_t const pos = claim<&mpmc_queue::enqueue, 0>(1);
+			if ( pos == npos )
+				return false;
+			cells[pos & mask].construct(std::forward<args_t>(args)...);
+			cells[pos & mask].sequence.store(pos + 1, std::memory_order_release);
+			return true;
+		}; // !try_emplace
+
+		bool try_push(value_type const &value) { return try_emplace(value); };
+		bool try_push(value_type &&value) { return try_emplace(std::move(value)); };
+
+		//! @brief pushes up to **count** elements from **first** into one contiguous run of cells, claimed at once.
+		//! @return the number of elements pushed
+		template<std::input_iterator iterator>
+		std::size_t try_push_n(iterator first, std::size_t count) {
+			std::size_t const pos = claim<&mpmc_queue::enqueue, 0>(count);
+			if ( pos == npos )
+				return 0;
+			for ( std::size_t i = 0; i < count; ++i, ++first ) {
+				cells[(pos + i) & mask].construct(*first);
+				cells[(pos + i) & mask].sequence.store(pos + i + 1, std::memory_order_release);
+			};
+			return count;
+		}; // !try_push_n
+
+		//! @brief removes the oldest element.
+		//! @return the element; or a null **std::optional**, if the queue is empty.
+		std::optional<value_type> try_pop() {
+			std::optional<value_type> result;
+			try_pop_n(1, [&result](value_type &&value) { result.emplace(std::move(value)); });
+			return result;
+		}; // !try_pop
+
+		//! @brief removes up to **count** consecutive elements, claimed at once, passing each to **sink** in order.
+		//! @return the number of elements removed
+		std::size_t try_pop_n(std::size_t count, auto &&sink) {
+			std::size_t const pos = claim<&mpmc_queue::dequeue, 1>(count);
+			if ( pos == npos )
+				return 0;
+			for ( std::size_t i = 0; i < count; ++i ) {
+				cells[(pos + i) & mask].consume(sink);
+				cells[(pos + i) & mask].sequence.store(pos + i + capacity, std::memory_order_release);
+			};
+			return count;
+		}; // !try_pop_n
+
+		//! @brief approximate number of elements
+		std::size_t size() const noexcept {
+			std::size_t const head = dequeue.load(std::memory_order_acquire);
+			std::size_t const tail = enqueue.load(std::memory_order_acquire);
+			return tail > head ? tail - head : 0;
+		}; // !size
+		bool empty() const noexcept { return !size(); };
+
+	private:
+		std::size_t static constexpr mask = capacity - 1;
+		std::size_t static constexpr npos = ~std::size_t{};
+
+		//! claims up to **count** consecutive cells whose sequence equals position + **lag**; shrinks **count** to the claimed run.
+		//! @return the first claimed position; **npos**, if no cell is ready or **count** is 0.
+		template<std::atomic<std::size_t> mpmc_queue::*position, std::size_t lag>
+		std::size_t claim(std::size_t &count) noexcept {
+			if ( !count )
+				return npos;							// nothing to claim: the retry loop below would never end
+			std::size_t pos = (this->*position).load(std::memory_order_relaxed);
+			for ( ;; ) {
+				std::size_t ready = 0;
+				while ( ready < count && ready < capacity &&
+						cells[(pos + ready) & mask].sequence.load(std::memory_order_acquire) == pos + ready + lag )
+					++ready;
+				if ( !ready ) {
+					std::size_t const seq = cells[pos & mask].sequence.load(std::memory_order_acquire);
+					if ( static_cast<std::ptrdiff_t>(seq - (pos + lag)) < 0 )
+						return npos;						// full (enqueue) or empty (dequeue)
+					pos = (this->*position).load(std::memory_order_relaxed);	// lost a race: retry
+				} else if ( (this->*position).compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed) ) {
+					count = ready;
+					return pos;
+				};
+			}; // !for ever
+		}; // !claim
+
+		template<std::atomic<std::size_t> mpmc_queue::*position, std::size_t lag>
+		std::size_t claim(std::size_t &&count) noexcept { return claim<position, lag>(count); };
+
+		alignas(cache_line_size) std::atomic<std::size_t> enqueue { 0 };
+		alignas(cache_line_size) std::atomic<std::size_t> dequeue { 0 };
+		detail::sequenced_cell<value_type> cells[capacity];
+	}; // !mpmc_queue
+
+	template<function_prototype signature, std::size_t capacity>
+	using spsc_call_queue = spsc_queue<deferred_call<signature>, capacity>;
+
+	template<function_prototype signature, std::size_t capacity>
+	using mpmc_call_queue = mpmc_queue<deferred_call<signature>, capacity>;
+
+	//! @brief pops up to **count** *deferred_call*s from **queue** in one batch and invokes them, discarding results.
+	//! @return the number of calls run
+	template<typename queue_type>
+	std::size_t run(queue_type &queue, std::size_t const count) {
+		return queue.try_pop_n(count, [](auto &&call) { call(); });
+	}; // !run
+
+}; // !lib_fm
+
+#endif // !CALL_QUEUE_HPP
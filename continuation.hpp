@@ -0,0 +1,73 @@
+#ifndef CONTINUATION_HPP
+#define CONTINUATION_HPP
+//! @file continuation.hpp
+//! @brief a header only trampoline running chains of *short_function* stages in constant stack space.
+//!
+//! instead of calling the next callback itself, each stage hands it to the 'trampoline' with *then* and returns; the
+//! trampoline loop calls it. the stack depth stays at one stage however long the chain, and every call returns to the same
+//! loop, which keeps the return-address predictor in step. a stage that doesn't call *then* ends the chain.
+//! where the compiler guarantees tail calls (**LIB_FM_MUSTTAIL**, i.e. [[clang::musttail]]), a free function stage may also jump
+//! straight to the next one, skipping the loop:
+//! @code
+//!	void parse_body(trampoline<session> &t) {
+//!		if ( t.state().more() )
+//!			LIB_FM_MUSTTAIL return parse_chunk(t);	// direct jump, where supported
+//!		t.then(monostate_from<&finish>);			// portable
+//!	};
+//!	trampoline<session> { s }.run(monostate_from<&parse_header>);
+//! @endcode
+
+#include <cstddef>
+#include <utility>
+#include "short_function.hpp"
+
+//! @brief expands to [[clang::musttail]] where guaranteed tail calls are supported; to nothing otherwise
+#if defined(__has_cpp_attribute)
+#	if __has_cpp_attribute(clang::musttail)
+#		define LIB_FM_MUSTTAIL [[clang::musttail]]
+#		define LIB_FM_HAS_MUSTTAIL 1
+#	endif
+#endif
+#ifndef LIB_FM_MUSTTAIL
+#	define LIB_FM_MUSTTAIL
+#	define LIB_FM_HAS_MUSTTAIL 0
+#endif
+
+namespace lib_fm {
+
+	//! @brief runs a continuation-passing chain of stages over a shared **context**
+	//! @tparam context the state the stages operate on
+	template<typename context>
+	class trampoline {
+	public:
+		//! @brief a pipeline stage; schedules its successor through the trampoline it receives
+		typedef short_function<void(trampoline &)> stage_type;
+
+		constexpr explicit trampoline(context &state) noexcept: shared { &state } {};
+
+		//! @brief the context shared by the stages
+		constexpr context &state() const noexcept { return *shared; };
+
+		//! @brief sets the stage to run after the current one returns, replacing any previous choice
+		constexpr void then(stage_type const next) noexcept { pending = next; };
+
+		//! @brief cancels the stage set by *then*, ending the chain after the current stage
+		constexpr void stop() noexcept { pending = {}; };
+
+		//! @brief runs **first**, then each stage scheduled in turn, until one schedules none
+		//! @return the number of stages run
+		std::size_t run(stage_type const first) {
+			std::size_t count = 0;
+			for ( pending = first; pending; ++count )
+				std::exchange(pending, stage_type {})(*this);
+			return count;
+		}; // !run
+
+	private:
+		context *shared;
+		stage_type pending;
+	}; // !trampoline
+
+}; // !lib_fm
+
+#endif // !CONTINUATION_HPP
@@ -0,0 +1,141 @@
+#ifndef CPU_DISPATCH_HPP
+#define CPU_DISPATCH_HPP
+//! @file cpu_dispatch.hpp
+//! @brief a header only runtime selector among *monostate_from* variants of a function, by CPU features.
+//!
+//! 'cpu_dispatch<signature, dispatch_variant<features, &impl>...>' probes the host CPU once, on first call, and picks the
+//! first variant, in declaration order, whose required features are all present; list the variants from the most to the
+//! least demanding. the last variant is the fallback, whatever it requires. like a PLT entry, the choice lives in an atomic
+//! slot that is constant-initialized to a resolver stub: the first call, from any translation unit and even during static
+//! initialization, probes the CPU, patches the slot and forwards. the slot is exposed ifunc-style as a free function pointer
+//! and as an empty callable for *short_function*; hot loops pay one indirect call and no feature test per call. *select*
+//! evaluates the choice for any feature set, to force a variant in tests.
+//!
+//! Example:
+//! @code
+//!	using sum = cpu_dispatch<float(float const *, std::size_t),
+//!		dispatch_variant<cpu_feature::avx512f, &sum_avx512>,
+//!		dispatch_variant<cpu_feature::avx2 | cpu_feature::fma, &sum_avx2>,
+//!		dispatch_variant<cpu_feature::none, &sum_scalar>>;
+//!	float const total = sum::pointer(data, size);
+//!	assert(sum::select(cpu_feature::none).target<decltype(&sum_scalar)>() == &sum_scalar);
+//! @endcode
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#	include <intrin.h>
+#endif
+#include "short_function.hpp"
+
+namespace lib_fm {
+
+	//! @brief instruction set extensions a dispatch variant may require; combine with '|'
+	enum class cpu_feature : std::uint32_t {
+		none		= 0,
+		sse2		= 1u << 0,
+		sse4_1		= 1u << 1,
+		sse4_2		= 1u << 2,
+		popcnt		= 1u << 3,
+		avx			= 1u << 4,
+		avx2		= 1u << 5,
+		fma			= 1u << 6,
+		bmi2		= 1u << 7,
+		avx512f		= 1u << 8,
+		avx512bw	= 1u << 9,
+		avx512vl	= 1u << 10,
+		neon		= 1u << 16
+	}; // !cpu_feature
+
+	constexpr cpu_feature operator|(cpu_feature const left, cpu_feature const right) noexcept
+	{	return static_cast<cpu_feature>(static_cast<std::uint32_t>(left) | static_cast<std::uint32_t>(right));	};
+
+	constexpr cpu_feature operator&(cpu_feature const left, cpu_feature const right) noexcept
+	{	return static_cast<cpu_feature>(static_cast<std::uint32_t>(left) & static_cast<std::uint32_t>(right));	};
+
+	//! @brief checks if **available** includes every feature in **required**
+	constexpr bool supports(cpu_feature const available, cpu_feature const required) noexcept
+	{	return (available & required) == required;	};
+
+#	include "detail/d_cpu_dispatch.hpp"
+
+	//! @brief the features of the executing CPU, usable by the OS. probed on first call.
+	inline cpu_feature detected_cpu_features() noexcept {
+		static cpu_feature const features = detail::probe_cpu_features();
+		return features;
+	}; // !detected_cpu_features
+
+	//! @brief one implementation of a dispatched function
+	//! @tparam required the features **fn** needs
+	//! @tparam fn the implementation; a free function pointer
+	template<cpu_feature required, auto fn>
+		requires is_function_pointer<decltype(fn)>
+	struct dispatch_variant {
+		cpu_feature static constexpr requirement = required;
+		auto static constexpr function = monostate_from<fn>;
+	}; // !dispatch_variant
+
+	//! @brief selects, once per process, the best variant of a function for the executing CPU
+	//! @tparam signature the common prototype of the variants
+	//! @tparam variants... *dispatch_variant*s, most demanding first
+	template<function_prototype signature, typename ... variants>
+		requires(sizeof...(variants) > 0)
+	struct cpu_dispatch {
+		typedef short_function<signature> function_type;
+		typedef typename function_type::free_pointer free_pointer;
+
+		//! @brief index of the variant chosen for **available**: the first one it supports, or else the last one
+		static constexpr std::size_t index(cpu_feature const available) noexcept {
+			std::size_t i = 0;
+			while ( i + 1 < std::size(requirements) && !supports(available, requirements[i]) )
+				++i;
+			return i;
+		}; // !index
+
+		//! @brief the variant chosen for **available**
+		static function_type select(cpu_feature const available) noexcept {
+			std::size_t const chosen = index(available);
+			std::size_t i = 0;
+			function_type result { first_variant };
+			(void)(... || (i++ == chosen && (result = variants::function, true)));
+			return result;
+		}; // !select
+
+	private:
+		static_assert((... && matched_callable<decltype(variants::function), signature>), "all variants must match the signature exactly");
+
+		static constexpr std::array<cpu_feature, sizeof...(variants)> requirements { variants::requirement... };
+		static constexpr auto first_variant = std::get<0>(std::tuple { variants::function... });
+
+		typedef typename function_type::return_type return_type;
+
+		template<typename ... args_t>
+		struct stub;
+
+		template<typename ... args_t>
+		struct stub<std::tuple<args_t...>> {
+			//! initial target of the slot: chooses the variant, patches the slot and forwards; concurrent first calls agree
+			static return_type resolve(args_t ... args) {
+				free_pointer const chosen = select(detected_cpu_features()).to_ptr();
+				slot.store(chosen, std::memory_order_release);
+				return chosen(std::forward<args_t>(args)...);
+			};
+
+			static return_type call(args_t ... args)
+			{	return slot.load(std::memory_order_relaxed)(std::forward<args_t>(args)...);	};
+		}; // !stub
+
+		inline static constinit std::atomic<free_pointer> slot { &stub<typename function_type::argument_tuple>::resolve };
+
+	public:
+		//! @brief free function pointer calling the variant chosen for this CPU, for hot loops and C APIs. a constant: valid
+		//! before *main*, in any translation unit.
+		static constexpr free_pointer pointer = &stub<typename function_type::argument_tuple>::call;
+		//! @brief the same, as an empty callable for *short_function*
+		static constexpr auto function = monostate_from<pointer>;
+	}; // !cpu_dispatch
+
+}; // !lib_fm
+
+#endif // !CPU_DISPATCH_HPP
@@ -0,0 +1,60 @@
+#ifndef DEFERRED_CALL_HPP
+#define DEFERRED_CALL_HPP
+//! @file deferred_call.hpp
+//! @brief a header only record of a *short_function* together with the arguments to call it with.
+//!
+//! a 'deferred_call<signature>' stores the function inline as a single *short_function* and its arguments as the
+//! *short_function*'s 'argument_tuple'; no allocation is involved, so it can live in fixed-size ring-buffer cells and be handed
+//! over between threads (see call_queue.hpp). reference parameters are stored as references: the referred objects must
+//! outlive the call.
+//!
+//! Example:
+//! @code
+//!	deferred_call<void(foo&, int)> call { monostate_from<&foo::resize>, std::ref(object), 42 };
+//!	call();	// object.resize(42)
+//! @endcode
+
+#include <utility>
+#include "short_function.hpp"
+
+namespace lib_fm {
+
+	//! @brief a *short_function* bound to a full set of arguments
+	//! @tparam signature the prototype of the stored *short_function*
+	template<function_prototype signature>
+	struct deferred_call {
+		typedef short_function<signature>					function_type;
+		typedef typename function_type::return_type		return_type;
+		typedef typename function_type::argument_tuple	argument_tuple;
+
+		//! @brief default constructor. only available if the function is nullable and the arguments are default constructible
+		constexpr deferred_call() noexcept(std::is_nothrow_default_constructible_v<argument_tuple>)
+			requires(function_type::is_nullable && std::is_default_constructible_v<argument_tuple>) = default;
+
+		//! @brief binds **fn** to **args**...
+		//! @param fn the function to call, or anything *short_function* is implicitly constructible from
+		//! @param args... values for each parameter of the signature
+		template<typename ... args_t>
+			requires std::is_constructible_v<argument_tuple, args_t&&...>
+		constexpr deferred_call(function_type const fn, args_t&& ... args)
+			noexcept(std::is_nothrow_constructible_v<argument_tuple, args_t&&...>):
+			function { fn }, arguments { std::forward<args_t>(args)... } {};
+
+		//! @brief calls the function with the stored arguments. arguments are moved out; call once.
+		return_type operator()() {
+			if constexpr ( function_type::argument_count )
+				return lib_fm::apply(function, std::move(arguments));
+			else
+				return function();
+		}; // !operator()
+
+		function_type	function;
+		argument_tuple	arguments;
+	}; // !deferred_call
+
+	template<function_prototype signature, typename ... args_t>
+	deferred_call(short_function<signature>, args_t&&...) -> deferred_call<signature>;
+
+}; // !lib_fm
+
+#endif // !DEFERRED_CALL_HPP
@@ -0,0 +1,152 @@
+#ifdef AWAITABLE_HPP
+
+	namespace detail {
+
+		//! result storage of a task promise
+		template<typename type>
+		struct task_result {
+			template<typename value_type>
+			void return_value(value_type &&value) { this->value.emplace(std::forward<value_type>(value)); };
+			void unhandled_exception() noexcept { error = std::current_exception(); };
+
+			type result() {
+				if ( error )
+					std::rethrow_exception(error);
+				return std::move(*value);
+			}; // !result
+
+			std::optional<type> value;
+			std::exception_ptr error;
+		}; // !task_result
+
+		template<>
+		struct task_result<void> {
+			void return_void() const noexcept {};
+			void unhandled_exception() noexcept { error = std::current_exception(); };
+
+			void result() const {
+				if ( error )
+					std::rethrow_exception(error);
+			}; // !result
+
+			std::exception_ptr error;
+		}; // !task_result<void>
+
+		template<typename result_type, typename ... context_t>
+		struct completion_signature { typedef void type(context_t..., result_type); };
+
+		template<typename ... context_t>
+		struct completion_signature<void, context_t...> { typedef void type(context_t...); };
+
+		//! the part of a callback awaiter the completion callback needs: the value, and whom to resume
+		template<typename result_type>
+		struct callback_node {
+			typedef std::conditional_t<std::is_void_v<result_type>, std::tuple<>, std::tuple<result_type>> value_tuple;
+			enum : int { idle, initiating, completed };
+
+			//! stores the result; resumes the awaiter, unless the operation completed before *await_suspend* returned.
+			//! may run on any thread: the awaiter is then resumed on that thread.
+			void complete(auto&& ... value) {
+				this->value.emplace(std::forward<decltype(value)>(value)...);
+				if ( state.exchange(completed, std::memory_order_acq_rel) == idle )
+					waiting.resume();
+			}; // !complete
+
+			result_type take() {
+				if constexpr ( !std::is_void_v<result_type> )
+					return std::get<0>(std::move(*value));
+			}; // !take
+
+			std::optional<value_tuple>	value;
+			std::coroutine_handle<>		waiting;
+			std::atomic<int>			state { idle };			// hands 'value' and 'waiting' over between the two threads
+			callback_node				*next = nullptr;		// fifo link
+		}; // !callback_node
+
+		//! common awaitable protocol: call the initiator from *await_suspend*, skip suspension on synchronous completion
+		template<typename derived, typename result_type, typename ... args_t>
+		struct callback_awaiter:
+			callback_node<result_type> {
+			template<typename ... init_t>
+			explicit callback_awaiter(init_t&& ... args): arguments { std::forward<init_t>(args)... } {};
+			callback_awaiter(callback_awaiter const &) = delete;
+
+			bool await_ready() const noexcept { return false; };
+
+			bool await_suspend(std::coroutine_handle<> const handle) {
+				this->waiting = handle;
+				this->state.store(this->initiating, std::memory_order_relaxed);
+				static_cast<derived &>(*this).initiate();
+				// fails iff the completion already ran: then it left the resumption to us, and we don't suspend
+				int expected = this->initiating;
+				return this->state.compare_exchange_strong(expected, this->idle, std::memory_order_acq_rel, std::memory_order_acquire);
+			}; // !await_suspend
+
+			result_type await_resume() { return this->take(); };
+
+			std::tuple<args_t...> arguments;
+		}; // !callback_awaiter
+
+		template<typename result_type, typename initiator_type, typename ... args_t>
+		struct context_awaiter:
+			callback_awaiter<context_awaiter<result_type, initiator_type, args_t...>, result_type, args_t...> {
+			typedef callback_awaiter<context_awaiter, result_type, args_t...> base_type;
+			typedef typename completion_signature<result_type, void *>::type callback_signature;
+
+			using base_type::base_type;
+
+			void initiate() {
+				lib_fm::short_function<callback_signature> const callback { [](void *const context, auto ... value) {
+					static_cast<context_awaiter *>(context)->complete(std::move(value)...);
+				} };
+				std::apply([this, callback](auto & ... args) {
+					initiator_type {}(args..., callback, static_cast<void *>(this));
+				}, this->arguments);
+			}; // !initiate
+		}; // !context_awaiter
+
+		//! per-thread queue of the awaiters of one initiator type, oldest first
+		template<typename initiator_type, typename result_type>
+		struct callback_fifo {
+			typedef callback_node<result_type> node_type;
+
+			static void push(node_type *const node) noexcept {
+				node->next = nullptr;
+				(tail ? tail->next : head) = node;
+				tail = node;
+			}; // !push
+
+			static node_type *pop() noexcept {
+				node_type *const node = head;
+				if ( node && !(head = node->next) )
+					tail = nullptr;
+				return node;
+			}; // !pop
+
+			inline static thread_local node_type *head = nullptr, *tail = nullptr;
+		}; // !callback_fifo
+
+		template<typename result_type, typename initiator_type, typename ... args_t>
+		struct fifo_awaiter:
+			callback_awaiter<fifo_awaiter<result_type, initiator_type, args_t...>, result_type, args_t...> {
+			typedef callback_awaiter<fifo_awaiter, result_type, args_t...> base_type;
+			typedef callback_fifo<initiator_type, result_type> fifo;
+			typedef typename completion_signature<result_type>::type callback_signature;
+
+			using base_type::base_type;
+
+			void initiate() {
+				fifo::push(this);
+				lib_fm::short_function<callback_signature> const callback { [](auto ... value) {
+					if ( auto const node = fifo::pop() )
+						node->complete(std::move(value)...);
+				} };
+				std::apply([callback](auto & ... args) {
+					initiator_type {}(args..., callback);
+				}, this->arguments);
+			}; // !initiate
+		}; // !fifo_awaiter
+
+	}; // !detail
+
+#endif // AWAITABLE_HPP
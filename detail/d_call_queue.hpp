@@ -0,0 +1,32 @@
+#ifdef CALL_QUEUE_HPP
+
+	namespace detail {
+
+		std::size_t constexpr inline cache_line_size = 64;
+
+		//! uninitialized inline storage for one queue element
+		template<typename value_type>
+		struct queue_cell {
+			template<typename ... args_t>
+			void construct(args_t&& ... args)
+			{	::new(static_cast<void *>(storage)) value_type(std::forward<args_t>(args)...);	};
+
+			void consume(auto &&sink) {
+				value_type &value = *std::launder(reinterpret_cast<value_type *>(storage));
+				sink(std::move(value));
+				std::destroy_at(&value);
+			}; // !consume
+
+			alignas(value_type) std::byte storage[sizeof(value_type)];
+		}; // !queue_cell
+
+		//! a cell owning a full cache line, with its sequence number next to the payload
+		template<typename value_type>
+		struct alignas(cache_line_size) sequenced_cell:
+			queue_cell<value_type> {
+			std::atomic<std::size_t> sequence;
+		}; // !sequenced_cell
+
+	}; // !detail
+
+#endif // CALL_QUEUE_HPP
@@ -0,0 +1,57 @@
+#ifdef CPU_DISPATCH_HPP
+
+	namespace detail {
+
+		inline cpu_feature probe_cpu_features() noexcept {
+			cpu_feature features = cpu_feature::none;
+			auto const add = [&features](bool const present, cpu_feature const feature) {
+				if ( present )
+					features = features | feature;
+			};
+#	if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+			__builtin_cpu_init();
+			add(__builtin_cpu_supports("sse2"), cpu_feature::sse2);
+			add(__builtin_cpu_supports("sse4.1"), cpu_feature::sse4_1);
+			add(__builtin_cpu_supports("sse4.2"), cpu_feature::sse4_2);
+			add(__builtin_cpu_supports("popcnt"), cpu_feature::popcnt);
+			add(__builtin_cpu_supports("avx"), cpu_feature::avx);
+			add(__builtin_cpu_supports("avx2"), cpu_feature::avx2);
+			add(__builtin_cpu_supports("fma"), cpu_feature::fma);
+			add(__builtin_cpu_supports("bmi2"), cpu_feature::bmi2);
+			add(__builtin_cpu_supports("avx512f"), cpu_feature::avx512f);
+			add(__builtin_cpu_supports("avx512bw"), cpu_feature::avx512bw);
+			add(__builtin_cpu_supports("avx512vl"), cpu_feature::avx512vl);
+#	elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+			int regs[4];
+			__cpuid(regs, 0);
+			int const max_leaf = regs[0];
+			__cpuid(regs, 1);
+			int const ecx1 = regs[2], edx1 = regs[3];
+			int ebx7 = 0;
+			if ( max_leaf >= 7 ) {
+				__cpuidex(regs, 7, 0);
+				ebx7 = regs[1];
+			};
+			// the OS must save the wider registers on context switch:
+			bool const os_avx = (ecx1 >> 27 & 1) && (_xgetbv(0) & 0x6) == 0x6;
+			bool const os_avx512 = os_avx && (_xgetbv(0) & 0xe6) == 0xe6;
+			add(edx1 >> 26 & 1, cpu_feature::sse2);
+			add(ecx1 >> 19 & 1, cpu_feature::sse4_1);
+			add(ecx1 >> 20 & 1, cpu_feature::sse4_2);
+			add(ecx1 >> 23 & 1, cpu_feature::popcnt);
+			add(os_avx && (ecx1 >> 28 & 1), cpu_feature::avx);
+			add(os_avx && (ebx7 >> 5 & 1), cpu_feature::avx2);
+			add(os_avx && (ecx1 >> 12 & 1), cpu_feature::fma);
+			add(ebx7 >> 8 & 1, cpu_feature::bmi2);
+			add(os_avx512 && (ebx7 >> 16 & 1), cpu_feature::avx512f);
+			add(os_avx512 && (ebx7 >> 30 & 1), cpu_feature::avx512bw);
+			add(os_avx512 && (ebx7 >> 31 & 1), cpu_feature::avx512vl);
+#	elif defined(__aarch64__) || defined(_M_ARM64)
+			add(true, cpu_feature::neon);
+#	endif
+			return features;
+		}; // !probe_cpu_features
+
+	}; // !detail
+
+#endif // CPU_DISPATCH_HPP
@@ -0,0 +1,48 @@
+#ifdef INTERNED_METHOD_HPP
+
+namespace detail {
+
+	//! hashes the object representation; member pointers with padding bytes all hash alike and fall back to comparisons
+	template<typename method_type>
+	struct member_pointer_hash {
+		std::size_t operator()(method_type const &method) const noexcept {
+			if constexpr ( std::has_unique_object_representations_v<method_type> ) {
+				char bytes[sizeof(method_type)];
+				std::memcpy(bytes, &method, sizeof bytes);
+				return static_cast<std::size_t>(fnv1a({ bytes, sizeof bytes }));
+			} else
+				return 0;
+		};
+	}; // !member_pointer_hash
+
+	//! the process-wide set of interned member pointers of one type. elements of an unordered set keep their address
+	//! across rehashing, so each element is the record a handle points to. writers lock; handles read without locking.
+	template<typename method_type>
+	class intern_table {
+	public:
+		static method_type const *insert(method_type const method) {
+			auto &table = instance();
+			std::lock_guard const lock { table.mutex };
+			return &*table.records.insert(method).first;
+		}; // !insert
+
+		static std::size_t size() {
+			auto &table = instance();
+			std::lock_guard const lock { table.mutex };
+			return table.records.size();
+		}; // !size
+
+	private:
+		//! never destroyed: handles stay valid during static destruction
+		static intern_table &instance() {
+			static intern_table *const table = new intern_table;
+			return *table;
+		}; // !instance
+
+		std::mutex mutex;
+		std::unordered_set<method_type, member_pointer_hash<method_type>> records;
+	}; // !intern_table
+
+}; // !detail
+
+#endif // INTERNED_METHOD_HPP
@@ -0,0 +1,189 @@
+#ifdef MEMOIZED_HPP
+
+	namespace detail {
+
+		template<typename>
+		bool inline constexpr memo_is_span = false;
+
+		template<typename T, std::size_t extent>
+		bool inline constexpr memo_is_span<std::span<T, extent>> = true;
+
+		//! the owning type a parameter is stored as in a key: views are copied into strings, other non-owning types are refused
+		template<typename T>
+		struct memo_key_element {
+			static_assert(!std::is_pointer_v<T>, "memoized: pointer parameters would be cached by address, not by value.");
+			static_assert(!memo_is_span<T>, "memoized: a span does not own its elements; take a container by value instead.");
+			typedef T type;
+		};
+
+		template<typename char_t, typename traits_t>
+		struct memo_key_element<std::basic_string_view<char_t, traits_t>> { typedef std::basic_string<char_t, traits_t> type; };
+
+		template<typename>
+		struct memo_key;
+
+		template<typename ... args_t>
+		struct memo_key<std::tuple<args_t...>> { typedef std::tuple<typename memo_key_element<std::decay_t<args_t>>::type...> type; };
+
+		template<typename argument_tuple>
+		using memo_key_t = typename memo_key<argument_tuple>::type;
+
+		struct memo_hash {
+			template<typename ... keys_t>
+			std::size_t operator()(std::tuple<keys_t...> const &key) const noexcept {
+				return std::apply([](auto const & ... k) {
+					std::size_t seed = 0;
+					((seed ^= std::hash<std::remove_cvref_t<decltype(k)>>{}(k) + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2)), ...);
+					return seed;
+				}, key);
+			};
+		}; // !memo_hash
+
+		//! one independently locked, bounded piece of a memo_cache
+		template<typename key_type, typename value_type, lib_fm::memo_eviction policy, std::size_t capacity>
+		class memo_shard {
+			typedef std::uint32_t index_type;
+			index_type static constexpr nil = ~index_type{};
+			typedef std::unordered_map<key_type, index_type, memo_hash> map_type;
+
+			struct slot {
+				std::optional<value_type>		value;
+				typename map_type::iterator		where;
+				index_type						prev = nil, next = nil;	// lru list, most recent first
+				std::atomic<bool>				referenced { false };	// clock bit
+			};
+
+		public:
+			// at most capacity + 1 keys, transiently, before the victim is erased: the index never rehashes, so 'where' stays valid
+			memo_shard() { index.reserve(capacity + 1); };
+
+			std::optional<value_type> find(key_type const &key) {
+				if constexpr ( policy == lib_fm::memo_eviction::clock ) {
+					std::shared_lock const lock { mutex };
+					auto const it = index.find(key);
+					if ( it == index.end() )
+						return std::nullopt;
+					slots[it->second].referenced.store(true, std::memory_order_relaxed);
+					return slots[it->second].value;
+				} else {
+					std::unique_lock const lock { mutex };
+					auto const it = index.find(key);
+					if ( it == index.end() )
+						return std::nullopt;
+					unlink(it->second);
+					push_front(it->second);
+					return slots[it->second].value;
+				};
+			}; // !find
+
+			//! @return **true**, iff an entry was evicted to make room
+			bool insert(key_type &&key, value_type const &value) {
+				std::unique_lock const lock { mutex };
+				auto const [it, inserted] = index.try_emplace(std::move(key), nil);
+				if ( !inserted )
+					return false;					// computed concurrently by another thread
+				bool const evicted = used == capacity;
+				index_type const i = evicted ? victim() : used++;
+				if ( evicted )
+					index.erase(slots[i].where);
+				it->second = i;
+				slots[i].value = value;
+				slots[i].where = it;
+				slots[i].referenced.store(false, std::memory_order_relaxed);
+				if constexpr ( policy == lib_fm::memo_eviction::lru )
+					push_front(i);
+				return evicted;
+			}; // !insert
+
+			void clear() {
+				std::unique_lock const lock { mutex };
+				index.clear();
+				for ( index_type i = 0; i < used; ++i )
+					slots[i].value.reset();
+				used = hand = 0;
+				head = tail = nil;
+			}; // !clear
+
+		private:
+			index_type victim() noexcept {
+				if constexpr ( policy == lib_fm::memo_eviction::clock ) {
+					for ( ;; hand = (hand + 1) % capacity )
+						if ( !slots[hand].referenced.exchange(false, std::memory_order_relaxed) ) {
+							index_type const i = hand;
+							hand = (hand + 1) % capacity;
+							return i;
+						};
+				} else {
+					index_type const i = tail;
+					unlink(i);
+					return i;
+				};
+			}; // !victim
+
+			void unlink(index_type const i) noexcept {
+				slot &s = slots[i];
+				(s.prev != nil ? slots[s.prev].next : head) = s.next;
+				(s.next != nil ? slots[s.next].prev : tail) = s.prev;
+				s.prev = s.next = nil;
+			}; // !unlink
+
+			void push_front(index_type const i) noexcept {
+				slots[i].prev = nil;
+				slots[i].next = head;
+				(head != nil ? slots[head].prev : tail) = i;
+				head = i;
+			}; // !push_front
+
+			std::shared_mutex				mutex;
+			map_type						index;
+			std::unique_ptr<slot[]>			slots { new slot[capacity] };
+			index_type						used = 0, hand = 0;
+			index_type						head = nil, tail = nil;
+		}; // !memo_shard
+
+		//! the sharded, bounded cache behind a memoized function
+		template<typename key_type, typename value_type, lib_fm::memo_eviction policy, std::size_t capacity, std::size_t shards>
+		class memo_cache {
+			std::size_t static constexpr shard_capacity = capacity / shards;
+
+			struct alignas(64) shard_type {
+				memo_shard<key_type, value_type, policy, shard_capacity> cache;
+				std::atomic<std::uint64_t> hits { 0 }, misses { 0 }, evictions { 0 };
+			};
+
+		public:
+			value_type get_or_compute(key_type &&key, auto &&compute) {
+				shard_type &shard = table[memo_hash{}(key) % shards];
+				if ( auto cached = shard.cache.find(key) ) {
+					shard.hits.fetch_add(1, std::memory_order_relaxed);
+					return std::move(*cached);
+				};
+				shard.misses.fetch_add(1, std::memory_order_relaxed);
+				value_type result = compute();
+				if ( shard.cache.insert(std::move(key), result) )
+					shard.evictions.fetch_add(1, std::memory_order_relaxed);
+				return result;
+			}; // !get_or_compute
+
+			lib_fm::memo_statistics statistics() const noexcept {
+				lib_fm::memo_statistics result {};
+				for ( auto const &shard : table ) {
+					result.hits += shard.hits.load(std::memory_order_relaxed);
+					result.misses += shard.misses.load(std::memory_order_relaxed);
+					result.evictions += shard.evictions.load(std::memory_order_relaxed);
+				};
+				return result;
+			}; // !statistics
+
+			void clear() {
+				for ( auto &shard : table )
+					shard.cache.clear();
+			}; // !clear
+
+		private:
+			shard_type table[shards];
+		}; // !memo_cache
+
+	}; // !detail
+
+#endif // MEMOIZED_HPP
@@ -0,0 +1,154 @@
+#ifdef MESSAGE_DISPATCHER_HPP
+
+	namespace detail {
+
+		template<typename type>
+		bool constexpr is_span = false;
+
+		template<typename type, std::size_t extent>
+		bool constexpr is_span<std::span<type, extent>> = true;
+
+		//! only dynamic extents: the count on the wire is not checked against a fixed one
+		template<typename type>
+		bool constexpr is_const_span = false;
+
+		template<typename type>
+		bool constexpr is_const_span<std::span<type const, std::dynamic_extent>> = std::is_trivially_copyable_v<type>;
+
+		//! other spans are trivially copyable too, but would travel as a bare pointer
+		template<typename type>
+		concept wire_type =
+			std::is_same_v<type, std::string_view> || is_const_span<type> ||
+			(std::is_trivially_copyable_v<type> && !std::is_pointer_v<type> && !std::is_member_pointer_v<type> && !is_span<type>);
+
+		template<typename type>
+		concept wire_parameter =
+			wire_type<std::remove_cvref_t<type>> && (!std::is_reference_v<type> || std::is_const_v<std::remove_reference_t<type>>);
+
+		template<typename>
+		struct wire_arguments;
+
+		template<typename object_type, typename ... args_t>
+		struct wire_arguments<std::tuple<object_type, args_t...>> {
+			static_assert((... && wire_parameter<args_t>), "parameters must be trivially copyable, std::string_view or std::span<const T> of dynamic extent, taken by value or const reference");
+			typedef std::tuple<std::remove_cvref_t<args_t>...> type;
+		}; // !wire_arguments
+
+		//! the decoded form of the parameters of a member function, without the object
+		template<typename method_type>
+		using wire_arguments_t = typename wire_arguments<bct::args_t<method_type>>::type;
+
+		//! an argument encodes as a parameter it converts to implicitly and without narrowing: no pointer reinterpreted as an
+		//! integer, no double truncated to an int
+		template<typename from, typename to>
+		concept wire_argument = std::is_convertible_v<from, to> && requires(from &&value) { to { std::forward<from>(value) }; };
+
+		template<typename wire_tuple, typename ... args_t>
+		bool constexpr wire_arguments_match = false;
+
+		template<typename ... wire_t, typename ... args_t>
+			requires(sizeof...(wire_t) == sizeof...(args_t))
+		bool constexpr wire_arguments_match<std::tuple<wire_t...>, args_t...> = (... && wire_argument<args_t, wire_t>);
+
+		//! sequential decoder; on the first failure it sticks to **ok == false** and yields empty values
+		struct wire_reader {
+			template<typename type>
+			type read() noexcept {
+				if constexpr ( std::is_same_v<type, std::string_view> ) {
+					auto const size = read<std::uint32_t>();
+					auto const chars = take(size);
+					return { reinterpret_cast<char const *>(chars), chars ? size : 0 };
+				} else if constexpr ( is_const_span<type> ) {
+					typedef typename type::element_type element_type;
+					auto const count = read<std::uint32_t>();
+					take((alignof(element_type) - position % alignof(element_type)) % alignof(element_type));
+					auto const elements = take(std::size_t { count } * sizeof(element_type));
+					if ( reinterpret_cast<std::uintptr_t>(elements) % alignof(element_type) )
+						ok = false;
+					if ( !ok )
+						return {};
+					return { reinterpret_cast<element_type const *>(elements), count };
+				} else {
+					type value {};
+					if ( auto const bytes = take(sizeof(type)) )
+						std::memcpy(&value, bytes, sizeof(type));
+					return value;
+				};
+			}; // !read
+
+			std::byte const *take(std::size_t const size) noexcept {
+				if ( !ok || in.size() - position < size ) {
+					ok = false;
+					return nullptr;
+				};
+				return in.data() + std::exchange(position, position + size);
+			}; // !take
+
+			std::span<std::byte const> in;
+			std::size_t position = 0;
+			bool ok = true;
+		}; // !wire_reader
+
+		//! sequential encoder; on the first overflow it sticks to **ok == false**
+		struct wire_writer {
+			template<wire_type type>
+			void write(type const &value) noexcept {
+				if constexpr ( std::is_same_v<type, std::string_view> ) {
+					write(static_cast<std::uint32_t>(value.size()));
+					put(value.data(), value.size());
+				} else if constexpr ( is_const_span<type> ) {
+					typedef typename type::element_type element_type;
+					write(static_cast<std::uint32_t>(value.size()));
+					std::size_t const padding = (alignof(element_type) - position % alignof(element_type)) % alignof(element_type);
+					std::byte constexpr zeros[alignof(element_type)] {};
+					put(zeros, padding);
+					put(value.data(), value.size_bytes());
+				} else
+					put(&value, sizeof(type));
+			}; // !write
+
+			void put(void const *const data, std::size_t const size) noexcept {
+				if ( !ok || out.size() - position < size ) {
+					ok = false;
+					return;
+				};
+				if ( size )
+					std::memcpy(out.data() + position, data, size);
+				position += size;
+			}; // !put
+
+			std::span<std::byte> out;
+			std::size_t position = 0;
+			bool ok = true;
+		}; // !wire_writer
+
+		//! the table entry of one method: decode, apply, encode
+		template<typename method_type, typename service_type>
+		dispatch_result handle_message(service_type &service, std::span<std::byte const> const request, std::span<std::byte> const response) {
+			typedef wire_arguments_t<typename method_type::target_type> wire_tuple;
+			typedef bct::return_type_t<typename method_type::target_type> return_type;
+
+			wire_reader reader { request };
+			auto arguments = [&]<std::size_t ... idx>(std::index_sequence<idx...>) {
+				return std::tuple<service_type &, std::tuple_element_t<idx, wire_tuple>...>	// braces: decoded in order
+					{ service, reader.template read<std::tuple_element_t<idx, wire_tuple>>()... };
+			}(std::make_index_sequence<std::tuple_size_v<wire_tuple>>{});
+			if ( !reader.ok || reader.position != request.size() )
+				return { dispatch_status::malformed, 0 };
+
+			if constexpr ( std::is_void_v<return_type> ) {
+				lib_fm::apply(method_type {}, std::move(arguments));
+				return { dispatch_status::ok, 0 };
+			} else {
+				static_assert(wire_type<std::remove_cvref_t<return_type>>, "the result must be trivially copyable, std::string_view or std::span<const T>");
+				wire_writer writer { response };
+				writer.write<std::remove_cvref_t<return_type>>(lib_fm::apply(method_type {}, std::move(arguments)));
+				if ( !writer.ok )
+					return { dispatch_status::overflow, 0 };
+				return { dispatch_status::ok, writer.position };
+			};
+		}; // !handle_message
+
+	}; // !detail
+
+#endif // MESSAGE_DISPATCHER_HPP
@@ -4,7 +4,7 @@ namespace detail { //dirty book: contains the (nasty) cheats
 	namespace bct = boost::callable_traits;
 
 	template< typename fn_type, fn_type fn>
-	struct zero_bind
+	struct LIB_FM_VISIBLE zero_bind
 	:	lib_fm::function_crtp_base<zero_bind<fn_type, fn> const,bct::function_type_t<fn_type>> {
 		using base_type = lib_fm::function_crtp_base<zero_bind<fn_type, fn> const, bct::function_type_t<fn_type>>;
 		using typename base_type::proto_type;
@@ -20,15 +20,33 @@ namespace detail { //dirty book: contains the (nasty) cheats
 
 	private:
 		friend class base_type::function_crtp_base;
-		decltype(auto) static do_invoke(auto&& ... args) { return lib_fm::invoke(std::forward<target_type>(fn), std::forward<decltype(args)>(args)...); };
+		decltype(auto) static do_invoke(auto&& ... args) {
+#if LIB_FM_SYMBOL_MAP
+			register_once<zero_bind>([] {
+				add_symbol(&target_function, sizeof target_function, symbol_kind::target,
+					describe<zero_bind, proto_type>("monostate_from target", std::is_member_pointer_v<fn_type> ? "instance method" : "free function"));
+			});
+#endif
+			LIB_FM_TRACE_SCOPE(monostate_from, &target_function);
+			return lib_fm::invoke(std::forward<target_type>(fn), std::forward<decltype(args)>(args)...);
+		}; // !do_invoke
 
 	public:
 
 		constexpr operator function_ptr()const noexcept {
 			if constexpr (std::is_same_v<target_type, function_ptr>)
 				return target_function;
-			else 
-				return [] (auto...args) { return do_invoke(std::forward<decltype(args)>(args)...);	};
+			else {
+				function_ptr const thunk = [] (auto...args) { return do_invoke(std::forward<decltype(args)>(args)...);	};
+#if LIB_FM_SYMBOL_MAP
+				if ( !std::is_constant_evaluated() )
+					register_once<std::tuple<zero_bind, function_ptr>>([thunk] {
+						add_symbol(erased_address(thunk), thunk_size_estimate, symbol_kind::thunk,
+							describe<zero_bind, proto_type>("monostate_from thunk", "instance method"));
+					});
+#endif
+				return thunk;
+			};
 		};
 	}; // !zero_bind<fn_type, fn>
 
@@ -0,0 +1,35 @@
+#ifdef PLUGIN_LOADER_HPP
+
+	namespace detail {
+
+		//! a string literal usable as a template argument
+		template<std::size_t size>
+		struct fixed_string {
+			constexpr fixed_string(char const (&text)[size]) noexcept { std::copy_n(text, size, value); };
+			char value[size];
+		}; // !fixed_string
+
+		//! intrusive record of a patched slot, so that closing the library can restore its resolver
+		struct bound_symbol {
+			void		(*reset)();
+			bound_symbol	*next = nullptr;
+		}; // !bound_symbol
+
+#	if defined(_WIN32)
+		int constexpr inline default_open_flags = 0;
+
+		inline void *dl_open(char const *const path, int) noexcept { return ::LoadLibraryA(path); };
+		inline void *dl_symbol(void *const handle, char const *const name) noexcept
+		{	return reinterpret_cast<void *>(::GetProcAddress(static_cast<HMODULE>(handle), name));	};
+		inline void dl_close(void *const handle) noexcept { ::FreeLibrary(static_cast<HMODULE>(handle)); };
+#	else
+		int constexpr inline default_open_flags = RTLD_LAZY | RTLD_GLOBAL;
+
+		inline void *dl_open(char const *const path, int const flags) noexcept { return ::dlopen(path, flags); };
+		inline void *dl_symbol(void *const handle, char const *const name) noexcept { return ::dlsym(handle, name); };
+		inline void dl_close(void *const handle) noexcept { ::dlclose(handle); };
+#	endif
+
+	}; // !detail
+
+#endif // PLUGIN_LOADER_HPP
@@ -5,42 +5,31 @@
 
 		template<typename test>
 			requires std::is_class_v<test>
-		static constexpr void reflect(){};
+		LIB_FM_VISIBLE inline constexpr void reflect(){};
 
 		template<typename test>
-		static constexpr void(*reflect_id)() = [] ()constexpr {
+		inline constexpr void(*reflect_id)() = [] ()constexpr {
 			if constexpr (std::is_member_function_pointer_v<test>)
 				return &reflect<bct::class_of_t<test>>;
 			else
 				return nullptr;
 		}(); 
 
-		template<typename A, typename...choice>
-		struct smallest {
-			auto static test() {
-				if constexpr ( !!sizeof...(choice) )
-					if constexpr ( (false || ... || (sizeof(A) > sizeof(choice))) )
-						return smallest<choice...>::test();
-				return std::type_identity<A>{};
-			};
-			typedef typename decltype(test())::type type;
-		};
-
 		template< typename derived, function_prototype signature 
 			, typename base_type = function_crtp_base<derived const, signature>
 		>
-		struct short_function_def:
+		struct LIB_FM_VISIBLE short_function_def:
 			base_type {
 		public:
 			using typename base_type::return_type;
 			using typename base_type::argument_tuple;
-			using  base_type::template argument_type;
+			template<std::size_t N>
+			using argument_type = typename base_type::template argument_type<N>;
 			using base_type::argument_count;
 			using base_type::operator();
 
 		protected:
 			using base_type::nullfn;
-			using proto = typename base_type::proto;
 			enum class short_function_command { callable, source, exact_match, z_target, long_manager };
 
 			bool static constexpr is_nullable {
@@ -49,17 +38,37 @@
 				//std::is_constructible_v<return_type, std::nullptr_t>
 			};
 
-			static auto tuple_manager(trivial_callable<signature> auto fn) noexcept {
+			//! spelled out rather than deduced from 'tuple_manager', which would instantiate it once more per signature
+			typedef std::tuple<
+				std::add_pointer_t<signature>,
+				short_function_source,
+				bool,
+				std::tuple<void (*)(), void const *>,
+				void *(*)(int)
+			> tuple_manager_value;
+			typedef tuple_manager_value const *tuple_manager_type;
+
+			static tuple_manager_value tuple_manager(trivial_callable<signature> auto fn) noexcept {
 				typedef decltype(fn) fn_type;
 
+				// a *monostate_from* is called through its target: its own call operator would trace every call a second time
 				auto static lambda = [](auto...args)->return_type {
-					std::remove_reference_t<fn_type> fn {};
-					return lib_fm::invoke(std::forward<fn_type>(fn), std::forward<decltype(args)>(args)...);
+					if constexpr ( zero_cost_binding<fn_type> )
+						return lib_fm::invoke(fn_type::target_function, std::forward<decltype(args)>(args)...);
+					else {
+						std::remove_reference_t<fn_type> fn {};
+						return lib_fm::invoke(std::forward<fn_type>(fn), std::forward<decltype(args)>(args)...);
+					};
 				};
 
 				return std::make_tuple(
 					[](fn_type fn) constexpr -> std::add_pointer_t<signature> {
-						if constexpr ( std::is_constructible_v< std::add_pointer_t<signature>, fn_type> )
+						if constexpr ( zero_cost_binding<fn_type> ) {
+							if constexpr ( std::is_same_v<typename fn_type::target_type, std::add_pointer_t<signature>> )
+								return fn_type::target_function;
+							else
+								return lambda;	// not the thunk of the monostate_from, which is traced
+						} else if constexpr ( std::is_constructible_v< std::add_pointer_t<signature>, fn_type> )
 							return static_cast<std::add_pointer_t<signature>> (std::forward<fn_type>(fn));
 						else {
 							return lambda;
@@ -95,15 +104,22 @@
 				);
 			};
 
-			typedef decltype(tuple_manager<proto>({})) tuple_manager_value;
-			typedef tuple_manager_value const *tuple_manager_type;
-
 			template <short_function_command command>
 			static auto constexpr command_query(tuple_manager_type const mgr) noexcept
 			{ return get<static_cast<std::size_t>(command)>(*mgr); };
 
 			static auto make_manager(trivial_callable<signature> auto fn, tuple_manager_type const) noexcept {
 				auto static table { tuple_manager(fn) };
+#if LIB_FM_SYMBOL_MAP
+				register_once<std::tuple<derived, decltype(fn)>>([] {
+					auto const source = command_query<short_function_command::source>(&table);
+					add_symbol(&table, sizeof table, symbol_kind::manager,
+						describe<decltype(fn), signature>("short_function manager", to_string_view(source)));
+					if ( !command_query<short_function_command::exact_match>(&table) || source != short_function_source::free_function )
+						add_symbol(erased_address(command_query<short_function_command::callable>(&table)), thunk_size_estimate,
+							symbol_kind::thunk, describe<decltype(fn), signature>("short_function thunk", to_string_view(source)));
+				});
+#endif
 				return &table;
 			};
 
@@ -203,9 +219,9 @@
 				return command_query<command>(reinterpret_cast<func_manager_type>(mgr));
 			};
 
-			//could be a struct, but function is more abstract:
-			using manager_type = typename smallest<tuple_manager_type, func_manager_type, void const *, void_func_manager_type>::type;
-			//using manager_type = tuple_manager_type;
+			//could be a struct, but function is more abstract. all four are pointer-sized: the tuple table is the one selected, and
+			//being the only one used, the only one whose 'make_manager' and 'command_query' overloads get instantiated.
+			using manager_type = tuple_manager_type;
 			//using manager_type = func_manager_type;
 			//using manager_type = void const *;
 			//using manager_type = void_func_manager_type;
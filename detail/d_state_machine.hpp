@@ -0,0 +1,39 @@
+#ifdef STATE_MACHINE_HPP
+
+	namespace detail {
+
+		template<typename event_type>
+		struct event_id_of { typedef decltype(event_type::id) type; };
+
+		template<typename event_type>
+			requires std::is_enum_v<event_type>
+		struct event_id_of<event_type> { typedef event_type type; };
+
+		template<typename event_type>
+		using event_id_t = std::remove_cv_t<typename event_id_of<event_type>::type>;
+
+		template<typename event_type>
+		constexpr auto event_id(event_type const &event) noexcept {
+			if constexpr ( std::is_enum_v<event_type> )
+				return event;
+			else
+				return event.id;
+		}; // !event_id
+
+		template<typename context, typename event_type>
+		void ignore_event(context &, event_type const &) noexcept {};
+
+		//! the table entry of one action: an ordinary function, so that the table holds plain pointers
+		template<auto action, typename context, typename event_type>
+		void transition_action(context &object, event_type const &event) {
+			if constexpr ( std::is_null_pointer_v<decltype(action)> )
+				return;
+			else if constexpr ( std::is_invocable_v<decltype(action) const &, context &, event_type const &> )
+				lib_fm::invoke(action, object, event);
+			else
+				lib_fm::invoke(action, object);
+		}; // !transition_action
+
+	}; // !detail
+
+#endif // STATE_MACHINE_HPP
@@ -0,0 +1,70 @@
+#ifdef SYMBOL_MAP_HPP
+
+	namespace detail {
+
+		//! assumed size of a generated thunk: their real extent isn't observable from C++
+		std::size_t constexpr inline thunk_size_estimate = 64;
+
+		struct symbol_registry {
+			std::mutex					mutex;
+			std::vector<symbol_record>	records;
+		}; // !symbol_registry
+
+		//! never destroyed: managers may be created during static destruction
+		inline symbol_registry &symbols() noexcept {
+			static symbol_registry *const instance = new symbol_registry;
+			return *instance;
+		}; // !symbols
+
+		inline void add_symbol(void const *const address, std::size_t const size, symbol_kind const kind, std::string name) {
+			auto &shared = symbols();
+			std::lock_guard const lock { shared.mutex };
+			shared.records.push_back({ address, size, kind, std::move(name) });
+		}; // !add_symbol
+
+		//! runs **add** once per **tag** type
+		template<typename tag>
+		void register_once(auto const &add) { [[maybe_unused]] bool static const done = (add(), true); };
+
+		//! the **type** part of *type_signature*
+		template<typename type>
+		std::string_view type_name() noexcept {
+			auto const probe = type_signature<void>();
+			auto const prefix = probe.find("void");
+			auto const suffix = probe.size() - prefix - 4;
+			auto const full = type_signature<type>();
+			return full.substr(prefix, full.size() - prefix - suffix);
+		}; // !type_name
+
+		//! e.g. "short_function thunk [instance method] lib_fm::make_monostate_from_overload<...> as int(foo&, int)"
+		template<typename fn_type, typename signature>
+		std::string describe(std::string_view const role, std::string_view const source) {
+			std::string name { role };
+			name.append(" [").append(source).append("] ").append(type_name<fn_type>());
+			name.append(" as ").append(type_name<signature>());
+			return name;
+		}; // !describe
+
+		inline unsigned long process_id() noexcept {
+#	if defined(_WIN32)
+			return static_cast<unsigned long>(_getpid());
+#	else
+			return static_cast<unsigned long>(getpid());
+#	endif
+		}; // !process_id
+
+		inline void write_json_string(std::ostream &out, std::string_view const text) {
+			out << '"';
+			for ( char const c : text )
+				if ( c == '"' || c == '\\' )
+					out << '\\' << c;
+				else if ( static_cast<unsigned char>(c) < 0x20 )
+					out << ' ';
+				else
+					out << c;
+			out << '"';
+		}; // !write_json_string
+
+	}; // !detail
+
+#endif // SYMBOL_MAP_HPP
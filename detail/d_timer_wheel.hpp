@@ -0,0 +1,30 @@
+#ifdef TIMER_WHEEL_HPP
+
+	namespace detail {
+
+		//! pool node of the timing wheel: an 8-byte callback plus an index based intrusive link
+		template<typename callback_type, typename tick_type>
+		struct timer_node {
+			typedef std::uint32_t index_type;
+			index_type static constexpr nil = std::numeric_limits<index_type>::max();
+
+			callback_type callback;
+			index_type next = nil;
+			index_type prev = nil;
+			index_type slot = nil;			// owning list, needed to unlink a list head
+			index_type generation = 0;		// bumped on release; invalidates outstanding ids
+			tick_type expiry = 0;
+
+			static constexpr timer_id make_id(index_type const idx, index_type const generation) noexcept
+			{	return static_cast<timer_id>(std::uint64_t{ generation } << 32 | idx);	};
+
+			static constexpr index_type index_of(timer_id const id) noexcept
+			{	return static_cast<index_type>(static_cast<std::uint64_t>(id));	};
+
+			static constexpr index_type generation_of(timer_id const id) noexcept
+			{	return static_cast<index_type>(static_cast<std::uint64_t>(id) >> 32);	};
+		}; // !timer_node
+
+	}; // !detail
+
+#endif // TIMER_WHEEL_HPP
@@ -0,0 +1,100 @@
+#ifdef TRACE_HPP
+
+	namespace detail {
+
+		//! one compact binary record. the fields are relaxed atomics only so that a concurrent flush is not a data race:
+		//! on mainstream targets they compile to plain stores.
+		struct trace_slot {
+			std::atomic<void const *>	id;
+			std::atomic<std::uint64_t>	start;
+			std::atomic<std::uint32_t>	duration;
+			std::atomic<trace_source>	source;
+		}; // !trace_slot
+
+		static_assert((LIB_FM_TRACE_CAPACITY & (LIB_FM_TRACE_CAPACITY - 1)) == 0, "LIB_FM_TRACE_CAPACITY must be a power of two");
+
+		//! a single-writer ring owned by one thread; the oldest records are overwritten when full. a seqlock of sorts: a reader
+		//! that sees any store of record **index** + capacity, then fences, is guaranteed to see **head** >= **index** + capacity.
+		struct trace_ring {
+			std::size_t static constexpr capacity = LIB_FM_TRACE_CAPACITY;
+
+			void push(void const *const id, std::uint64_t const start, std::uint64_t const duration, trace_source const source) noexcept {
+				auto const index = head.load(std::memory_order_relaxed);
+				auto &slot = slots[index & (capacity - 1)];
+				std::atomic_thread_fence(std::memory_order_release);	// orders the previous head store before the slot stores
+				slot.id.store(id, std::memory_order_relaxed);
+				slot.start.store(start, std::memory_order_relaxed);
+				slot.duration.store(static_cast<std::uint32_t>(std::min<std::uint64_t>(duration, UINT32_MAX)), std::memory_order_relaxed);
+				slot.source.store(source, std::memory_order_relaxed);
+				head.store(index + 1, std::memory_order_release);
+			}; // !push
+
+			std::uint32_t				thread = 0;
+			std::atomic<std::uint64_t>	head { 0 };		// records ever written
+			std::uint64_t				flushed = 0;	// records already flushed; guarded by the registry mutex
+			std::array<trace_slot, capacity> slots;
+		}; // !trace_ring
+
+		//! every ring, including those of exited threads that still hold unflushed records
+		struct trace_registry {
+			std::mutex							mutex;
+			std::vector<std::shared_ptr<trace_ring>>	rings;
+			std::uint32_t						next_thread = 1;
+			std::atomic<bool>					enabled { false };
+		}; // !trace_registry
+
+		//! never destroyed: threads may still trace during static destruction
+		inline trace_registry &registry() noexcept {
+			static trace_registry *const instance = new trace_registry;
+			return *instance;
+		}; // !registry
+
+		inline thread_local trace_ring *local_ring = nullptr;
+
+		//! slow path of the first traced call on a thread; allocates the ring before any timestamp is taken
+		inline trace_ring &register_ring() {
+			thread_local std::shared_ptr<trace_ring> const owner = [] {
+				auto ring = std::make_shared<trace_ring>();
+				auto &shared = registry();
+				std::lock_guard const lock { shared.mutex };
+				ring->thread = shared.next_thread++;
+				shared.rings.push_back(ring);
+				return ring;
+			}();
+			return *(local_ring = owner.get());
+		}; // !register_ring
+
+		inline std::uint64_t trace_now() noexcept {
+			return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>
+				(std::chrono::steady_clock::now().time_since_epoch()).count());
+		}; // !trace_now
+
+		//! records one complete event, from construction to destruction, if tracing is enabled at construction
+		class trace_scope {
+		public:
+			trace_scope(trace_source const source, void const *const id) noexcept:
+				id { registry().enabled.load(std::memory_order_relaxed) && (local_ring || &register_ring()) ? id : nullptr },
+				source { source },
+				start { this->id ? trace_now() : 0 } {};
+
+			~trace_scope() {
+				if ( id )
+					local_ring->push(id, start, trace_now() - start, source);
+			}; // !~trace_scope
+
+			trace_scope(trace_scope const &) = delete;
+			trace_scope &operator=(trace_scope const &) = delete;
+
+		private:
+			void const		*id;
+			trace_source	source;
+			std::uint64_t	start;
+		}; // !trace_scope
+
+		inline void write_microseconds(std::ostream &out, std::uint64_t const ns) {
+			out << ns / 1000 << '.' << std::setw(3) << std::setfill('0') << ns % 1000 << std::setfill(' ');
+		}; // !write_microseconds
+
+	}; // !detail
+
+#endif // TRACE_HPP
@@ -4,11 +4,11 @@
 
 template<typename derived, typename signature, function_prototype proto_type= signature>
 //requires function_prototype<signature>
-class function_crtp_base
+class LIB_FM_VISIBLE function_crtp_base
 { static_assert(std::is_same_v<signature, proto_type>,"generic implementaion must fail."); };//declare defaults
 
 template<typename derived, function_prototype signature, typename result_type, typename ... args_t>
-class function_crtp_base <derived, result_type(args_t ...), signature> {
+class LIB_FM_VISIBLE function_crtp_base <derived, result_type(args_t ...), signature> {
 	bool constexpr static is_const	= std::is_const_v<std::remove_reference_t<derived>>;
 	bool constexpr static is_rvalue = std::is_rvalue_reference_v<derived>;
 	bool constexpr static is_lvalue = std::is_lvalue_reference_v<derived>;
@@ -74,8 +74,37 @@ namespace detail {
 	struct is_function_crtp_base<function_crtp_base<crtp, signature>, signature>: std::true_type {};
 
 	template<typename fn_type, function_prototype signature, typename crtp_base= typename fn_type::function_crtp>
-	bool constexpr static derived_from_function_crtp_base =	is_function_crtp_base<crtp_base, signature>::value &&
+	bool constexpr inline derived_from_function_crtp_base =	is_function_crtp_base<crtp_base, signature>::value &&
 															std::is_base_of_v<crtp_base,fn_type>;
+
+	//! compiler specific, but stable across binaries built by the same compiler
+	template<typename type>
+	constexpr std::string_view type_signature() noexcept {
+#	if defined(_MSC_VER)
+		return __FUNCSIG__;
+#	else
+		return __PRETTY_FUNCTION__;
+#	endif
+	}; // !type_signature
+
+	constexpr std::uint64_t fnv1a(std::string_view const text) noexcept {
+		std::uint64_t hash = 0xcbf29ce484222325ull;
+		for ( char const c : text )
+			hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3ull;
+		return hash;
+	}; // !fnv1a
+
+	template<typename type>
+	std::uint64_t constexpr inline type_id = fnv1a(type_signature<type>());
+
+	//! a data or function pointer as an opaque address: the id of a trace event or symbol record
+	template<typename pointer_type>
+	void const *erased_address(pointer_type const pointer) noexcept {
+		if constexpr ( std::is_function_v<std::remove_pointer_t<pointer_type>> )
+			return reinterpret_cast<void const *>(pointer);
+		else
+			return static_cast<void const *>(pointer);
+	}; // !erased_address
 }; // !detail
 
 template<typename F, typename T>
@@ -85,10 +114,9 @@ decltype(auto) apply(F&& f, T&& t) {
 	(std::index_sequence<idx...>) -> decltype(auto) { /*-> std::invoke_result_t<F, std::tuple_element_t<idx, T> ...>*/
 		typedef std::remove_cvref_t<F> func_t;
 		constexpr static auto size = sizeof...(idx);
-		typedef std::tuple_element_t<0, T> first_t;
-
 		if constexpr (std::is_member_pointer_v<func_t>) {
 			static_assert(size);
+			typedef std::tuple_element_t<0, T> first_t;
 
 			return [&f1, &t1] <std::size_t ... idx_1>(std::index_sequence<idx_1...>/*, F &&f, T &&t*/)-> decltype(auto)
 			/*-> std::invoke_result_t<F, std::tuple_element_t<idx, T> ...>*/ {
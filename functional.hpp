@@ -1,8 +1,22 @@
 #ifndef FUNCTION_CNCPT_HPP
 #define FUNCTION_CNCPT_HPP
 #include <tuple>
+#include <functional>
+#include <cstdint>
+#include <string_view>
 #include <type_traits>
-#include <boost/callable_traits.hpp>
+#include <boost/callable_traits/args.hpp>
+#include <boost/callable_traits/class_of.hpp>
+#include <boost/callable_traits/function_type.hpp>
+#include <boost/callable_traits/return_type.hpp>
+
+//! @brief exports the symbols of the marked class templates' instantiations, so that ELF shared objects share one copy of their
+//! manager tables and thunks (needs the host to export its own: -rdynamic, or plugins loaded with RTLD_GLOBAL).
+#if defined(_WIN32) || !defined(__GNUC__)
+#	define LIB_FM_VISIBLE
+#else
+#	define LIB_FM_VISIBLE __attribute__((visibility("default")))
+#endif
 
 namespace lib_fm {
 	namespace bct = boost::callable_traits;
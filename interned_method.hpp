@@ -0,0 +1,100 @@
+#ifndef INTERNED_METHOD_HPP
+#define INTERNED_METHOD_HPP
+//! @file interned_method.hpp
+//! @brief a header only library of pointer-sized handles to member function pointers chosen at runtime.
+//!
+//! *monostate_from* needs the member pointer as a compile-time constant. when it is only known at runtime (configuration,
+//! plugin tables), the member pointer itself is what gets stored, and its size depends on the class hierarchy: 16 bytes or
+//! more with multiple or virtual bases. *intern* stores each distinct member pointer once, in a process-wide table per member
+//! pointer type, and returns an 'interned_method': one pointer to that immutable record. calling it is one load plus the member
+//! call; equal member pointers yield equal handles, so handles compare and hash as plain pointers.
+//! interning takes a lock and may allocate; records are never freed. intern once, when the table is built, not per call.
+//!
+//! Example:
+//! @code
+//!	struct session { void on_text(message const &); void on_binary(message const &); };	// not overloaded: '&session::on_text' names one function
+//!	std::vector<interned_method<void (session::*)(message const &)>> handlers;	// one word per entry
+//!	handlers.push_back(intern(config.binary ? &session::on_binary : &session::on_text));
+//!	handlers.push_back(monostate_from<&session::on_text>);		// same handle as intern(&session::on_text)
+//!	handlers[0](object, msg);
+//! @endcode
+
+#include <cstring>
+#include <mutex>
+#include <unordered_set>
+#include "monostate_from.hpp"
+
+namespace lib_fm {
+#	include "detail/d_interned_method.hpp"
+
+	//! @brief a pointer-sized callable referring to an interned member function pointer
+	//! @tparam method_type the member function pointer type
+	template<typename method_type>
+		requires std::is_member_function_pointer_v<method_type>
+	class LIB_FM_VISIBLE interned_method:
+		public function_crtp_base<interned_method<method_type> const, bct::function_type_t<method_type>>
+	{
+	public:
+		using base_type = function_crtp_base<interned_method const, bct::function_type_t<method_type>>;
+		using typename base_type::proto_type;
+		using typename base_type::return_type;
+		using typename base_type::argument_tuple;
+		using base_type::argument_count;
+		using base_type::operator();
+		typedef method_type target_type;
+
+		//! @brief a null handle; calling it is undefined, as for a null member pointer
+		constexpr interned_method() noexcept = default;
+
+		//! @brief interns **method**; a null member pointer yields a null handle
+		explicit interned_method(method_type const method):
+			record { method ? detail::intern_table<method_type>::insert(method) : nullptr } {};
+
+		//! @brief interns the member pointer of a ***monostate_from***
+		template<zero_cost_binding fn_type>
+			requires std::is_same_v<typename std::remove_cvref_t<fn_type>::target_type, method_type>
+		interned_method(fn_type const fn):
+			interned_method { fn.target_function } {};
+
+		//! @brief the interned member pointer; or **nullptr**, if the handle is null
+		method_type target() const noexcept { return record ? *record : nullptr; };
+
+		//! @brief the handle as an opaque pointer, e.g. for the user data slot of a C API
+		void const *address() const noexcept { return record; };
+
+		//! @brief restores a handle from *address*
+		static interned_method from_address(void const *const address) noexcept {
+			interned_method result;
+			result.record = static_cast<method_type const *>(address);
+			return result;
+		}; // !from_address
+
+		//! @brief number of distinct member pointers of this type interned so far
+		static std::size_t interned_count() { return detail::intern_table<method_type>::size(); };
+
+		constexpr explicit operator bool() const noexcept { return record; };
+
+		//! @brief equal iff both refer to the same member pointer
+		friend bool constexpr operator==(interned_method const left, interned_method const right) noexcept
+		{	return left.record == right.record;	};
+
+	private:
+		friend class base_type::function_crtp_base;
+
+		return_type do_invoke(auto&& ... args) const
+		{	return lib_fm::invoke(*record, std::forward<decltype(args)>(args)...);	};
+
+		method_type const *record = nullptr;
+	}; // !interned_method
+
+	//! @brief interns a member function pointer chosen at runtime
+	//! @param method the member function pointer
+	//! @return a pointer-sized handle, equal to that of any earlier call with an equal **method**
+	template<typename method_type>
+		requires std::is_member_function_pointer_v<method_type>
+	interned_method<method_type> intern(method_type const method)
+	{	return interned_method<method_type> { method };	};
+
+}; // !lib_fm
+
+#endif // !INTERNED_METHOD_HPP
@@ -0,0 +1,143 @@
+//! @file lib_fm.ixx
+//! @brief the named module 'lib_fm': the whole library, parsed and instantiated once per build instead of once per
+//! translation unit.
+//!
+//! the headers are compiled in the global module fragment and their public names re-exported; 'detail' stays private.
+//! compiler status: the interface compiles with GCC 12.2 (-fmodules-ts), but GCC 12 can't import it; it doesn't make
+//! using-declarations of global module fragment entities visible to importers. importing hasn't been verified on any compiler:
+//! none of MSVC, Clang or a newer GCC was available. until it is, the headers remain the supported interface.
+//! tests/module/run.sh is the import smoke test, for GCC 14 or Clang 16 onwards; tests/run.sh skips it on older compilers.
+//! modules don't export macros: **LIB_FM_TRACE**, **LIB_FM_SYMBOL_MAP** and **LIB_FM_TRACE_CAPACITY** take effect when set
+//! while building this interface, and code needing **LIB_FM_MUSTTAIL**, **LIB_FM_VISIBLE** or **LIB_FM_TRACE_SCOPE** includes
+//! the header that defines it. headers and the module may be mixed in one program.
+//!
+//! Example, not verified to compile yet (see the compiler status above):
+//! @code
+//!	import lib_fm;
+//!	lib_fm::short_function<void(foo &)> f = lib_fm::monostate_from<&foo::bazz>;
+//! @endcode
+module;
+
+#include "short_function.hpp"
+#include "interned_method.hpp"
+#include "deferred_call.hpp"
+#include "call_queue.hpp"
+#include "timer_wheel.hpp"
+#include "memoized.hpp"
+#include "awaitable.hpp"
+#include "continuation.hpp"
+#include "cpu_dispatch.hpp"
+#include "state_machine.hpp"
+#include "message_dispatcher.hpp"
+#include "plugin_loader.hpp"
+
+export module lib_fm;
+
+export namespace lib_fm {
+	// functional.hpp:
+	using lib_fm::trivial_empty;
+	using lib_fm::function_prototype;
+	using lib_fm::is_function_pointer;
+	using lib_fm::primitive_callable;
+	using lib_fm::callable;
+	using lib_fm::matched_callable;
+	using lib_fm::trivial_callable;
+	using lib_fm::matched_trivial_callable;
+	using lib_fm::function_crtp_base;
+	using lib_fm::apply;
+	using lib_fm::invoke;
+
+	// monostate_from.hpp:
+	using lib_fm::zero_cost_binding;
+	using lib_fm::make_monostate_from_overload;
+	using lib_fm::make_monostate_from;
+	using lib_fm::monostate_from_overload;
+	using lib_fm::monostate_from;
+	using lib_fm::zbind_front_v;
+	using lib_fm::zbind_back_v;
+	using lib_fm::zbind_front;
+	using lib_fm::zbind_back;
+
+	// short_function.hpp:
+	using lib_fm::short_function_source;
+	using lib_fm::to_string_view;
+	using lib_fm::short_function;
+
+	// trace.hpp:
+	using lib_fm::trace_source;
+	using lib_fm::trace_enable;
+	using lib_fm::trace_enabled;
+	using lib_fm::trace_flush;
+
+	// symbol_map.hpp:
+	using lib_fm::symbol_kind;
+#if LIB_FM_SYMBOL_MAP
+	using lib_fm::symbol_record;
+	using lib_fm::symbol_map_entries;
+#endif
+	using lib_fm::write_perf_map;
+	using lib_fm::write_symbol_map;
+
+	// interned_method.hpp:
+	using lib_fm::interned_method;
+	using lib_fm::intern;
+
+	// deferred_call.hpp, call_queue.hpp:
+	using lib_fm::deferred_call;
+	using lib_fm::cache_line_size;
+	using lib_fm::spsc_queue;
+	using lib_fm::mpmc_queue;
+	using lib_fm::spsc_call_queue;
+	using lib_fm::mpmc_call_queue;
+	using lib_fm::run;
+
+	// timer_wheel.hpp:
+	using lib_fm::timer_id;
+	using lib_fm::timer_wheel;
+
+	// memoized.hpp:
+	using lib_fm::memo_eviction;
+	using lib_fm::memo_statistics;
+	using lib_fm::make_memoized;
+	using lib_fm::memoized;
+
+	// awaitable.hpp:
+	using lib_fm::run_loop;
+	using lib_fm::task;
+	using lib_fm::sync_wait;
+	using lib_fm::await_context_callback;
+	using lib_fm::await_callback;
+
+	// continuation.hpp:
+	using lib_fm::trampoline;
+
+	// cpu_dispatch.hpp:
+	using lib_fm::cpu_feature;
+	using lib_fm::operator|;
+	using lib_fm::operator&;
+	using lib_fm::supports;
+	using lib_fm::detected_cpu_features;
+	using lib_fm::dispatch_variant;
+	using lib_fm::cpu_dispatch;
+
+	// state_machine.hpp:
+	using lib_fm::enum_size;
+	using lib_fm::transition;
+	using lib_fm::state_machine;
+
+	// message_dispatcher.hpp:
+	using lib_fm::dispatch_status;
+	using lib_fm::dispatch_result;
+	using lib_fm::message_dispatcher;
+	using lib_fm::encode_request;
+	using lib_fm::decode_response;
+
+	// plugin_loader.hpp:
+	using lib_fm::symbol_entry;
+	using lib_fm::symbol_table_name;
+	using lib_fm::plugin_error;
+	using lib_fm::export_symbol;
+	using lib_fm::plugin;
+	using lib_fm::make_plugin_symbol;
+	using lib_fm::plugin_symbol;
+}; // !lib_fm
@@ -0,0 +1,107 @@
+#ifndef MEMOIZED_HPP
+#define MEMOIZED_HPP
+//! @file memoized.hpp
+//! @brief a header only concurrent memoization wrapper for pure free functions.
+//!
+//! ***memoized<fn>*** is an empty callable, just like ***monostate_from<fn>***, so it still fits in a *short_function*. the
+//! results are kept in a static, bounded cache private to each instantiation. the cache is split into shards, selected by the
+//! hash of the arguments, each with its own lock; entries are keyed on the decayed parameter types of **fn** and evicted by
+//! either a LRU or a CLOCK policy. keys own their data: string views are stored as strings, and pointer or span parameters
+//! are rejected at compile time. CLOCK hits only take a shared lock, LRU hits need an exclusive one to reorder the list.
+//! a miss calls **fn** outside the lock, so concurrent misses on the same key may call it more than once; **fn** must be pure.
+//!
+//! Example:
+//! @code
+//!	short_function<int(std::string_view)> lookup = memoized<&find_port, memo_eviction::clock>;
+//!	lookup("http");
+//!	auto const [hits, misses, evictions] = memoized<&find_port, memo_eviction::clock>.statistics();
+//! @endcode
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <cstdint>
+#include "functional.hpp"
+
+namespace lib_fm {
+
+	//! @brief replacement policy of a *memoized* cache
+	enum class memo_eviction {
+		//! @brief evicts the least recently used entry
+		lru,
+		//! @brief second chance approximation of LRU; hits don't serialize on the shard lock
+		clock
+	}; // !memo_eviction
+
+	//! @brief cumulative counters of a *memoized* cache
+	struct memo_statistics {
+		std::uint64_t hits;
+		std::uint64_t misses;
+		std::uint64_t evictions;
+	}; // !memo_statistics
+
+#	include "detail/d_memoized.hpp"
+
+	//! @brief an empty function object caching the results of **fn**.
+	//! @tparam fn pointer to a pure free function with a non-void return type and hashable, copyable decayed parameters
+	//! @tparam policy the eviction policy
+	//! @tparam capacity the maximum number of cached results, summed over all shards; a multiple of **shards**
+	//! @tparam shards number of independently locked shards, each holding **capacity** / **shards** results
+	template<auto fn, memo_eviction policy = memo_eviction::lru, std::size_t capacity = 1024, std::size_t shards = 16>
+		requires(is_function_pointer<decltype(fn)> && !std::is_void_v<bct::return_type_t<decltype(fn)>> && shards > 0 &&
+			capacity >= shards && capacity % shards == 0)
+	struct make_memoized:
+		function_crtp_base<make_memoized<fn, policy, capacity, shards> const, bct::function_type_t<decltype(fn)>>
+	{
+		static_assert(fn, "'nullptr' is not acceptable.");
+		using base_type = function_crtp_base<make_memoized const, bct::function_type_t<decltype(fn)>>;
+		using typename base_type::proto_type;
+		using typename base_type::return_type;
+		using typename base_type::argument_tuple;
+		using base_type::argument_count;
+		using base_type::operator();
+
+		typedef decltype(fn) target_type;
+		target_type static constexpr target_function = fn;
+
+		constexpr auto operator==(make_memoized const) const noexcept { return true; };
+		constexpr auto operator!=(make_memoized const) const noexcept { return false; };
+
+		//! @brief counters summed over all shards
+		static memo_statistics statistics() noexcept { return cache.statistics(); };
+		//! @brief drops every cached result; counters are kept
+		static void clear() { cache.clear(); };
+
+	private:
+		friend class base_type::function_crtp_base;
+
+		typedef detail::memo_key_t<argument_tuple>				key_type;
+		typedef std::remove_cvref_t<return_type>				value_type;
+		typedef detail::memo_cache<key_type, value_type, policy, capacity, shards> cache_type;
+
+		static return_type do_invoke(auto&& ... args) {
+			key_type key { args... };
+			return cache.get_or_compute(std::move(key),
+				[&args...] { return lib_fm::invoke(fn, std::forward<decltype(args)>(args)...); });
+		}; // !do_invoke
+
+		inline static cache_type cache;
+	}; // !make_memoized
+
+	//! @brief a zero-sized, memoizing equivalent of **fn**
+	//! @tparam fn the pure function to memoize
+	//! @tparam policy the eviction policy
+	//! @tparam capacity the maximum number of cached results; a multiple of **shards**
+	//! @tparam shards number of independently locked shards
+	template<auto fn, memo_eviction policy = memo_eviction::lru, std::size_t capacity = 1024, std::size_t shards = 16>
+	make_memoized<fn, policy, capacity, shards> inline constexpr memoized;
+
+}; // !lib_fm
+
+#endif // !MEMOIZED_HPP
@@ -0,0 +1,119 @@
+#ifndef MESSAGE_DISPATCHER_HPP
+#define MESSAGE_DISPATCHER_HPP
+//! @file message_dispatcher.hpp
+//! @brief a header only router of binary messages to *monostate_from* bound service methods.
+//!
+//! handlers are registered by method id in a flat table of free function pointers, one per ***monostate_from<&service::m>***.
+//! each is generated from the method's 'argument_tuple': it decodes the parameters straight out of the request buffer,
+//! invokes the method through *lib_fm::apply* and encodes the return value into the response buffer.
+//! the wire format is the host's native representation, with no header; the method id travels out of band:
+//! - a trivially copyable parameter takes its sizeof bytes, unaligned;
+//! - a 'std::string_view' is a 32-bit length followed by the characters;
+//! - a 'std::span<type const>' of a trivially copyable **type**, with dynamic extent, is a 32-bit count, padding to alignof(type) from the start
+//!   of the buffer, then the elements.
+//! views point into the request buffer, without a copy: they are only valid during the call, and for spans the request buffer
+//! must be aligned at least as strictly as their elements. parameters may be taken by value or by const reference.
+//!
+//! Example:
+//! @code
+//!	message_dispatcher<kv_store> dispatcher { store };
+//!	dispatcher.add(1, monostate_from<&kv_store::get>);		// std::string_view get(std::string_view key) const
+//!	auto const size = encode_request<&kv_store::get>(request, "user:42");
+//!	auto const [status, written] = dispatcher.dispatch(1, std::span { request }.first(*size), response);
+//!	auto const value = decode_response<&kv_store::get>(std::span { response }.first(written));
+//! @endcode
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+#include "monostate_from.hpp"
+
+namespace lib_fm {
+
+	//! @brief outcome of *message_dispatcher::dispatch*
+	enum class dispatch_status {
+		//! @brief the handler ran; the response holds its encoded result
+		ok,
+		//! @brief no handler is registered under the method id
+		unknown_method,
+		//! @brief the request is truncated, has trailing bytes or a misaligned span
+		malformed,
+		//! @brief the result does not fit in the response buffer; the handler did run
+		overflow
+	}; // !dispatch_status
+
+	//! @brief status and number of response bytes written
+	struct dispatch_result {
+		dispatch_status status;
+		std::size_t written;
+	}; // !dispatch_result
+
+#	include "detail/d_message_dispatcher.hpp"
+
+	//! @brief a flat table of handlers for the methods of **service_type**, indexed by method id
+	//! @tparam service_type the class whose methods handle messages
+	template<typename service_type>
+	class message_dispatcher {
+	public:
+		typedef dispatch_result (*handler_type)(service_type &, std::span<std::byte const>, std::span<std::byte>);
+
+		explicit message_dispatcher(service_type &service) noexcept: service { &service } {};
+
+		//! @brief registers **method** under **id**, replacing any previous handler. ids should be small and dense.
+		//! @param id the method id
+		//! @param method ***monostate_from*** of a member function of **service_type**
+		template<zero_cost_binding method_type>
+			requires std::is_same_v<bct::class_of_t<typename std::remove_cvref_t<method_type>::target_type>, service_type>
+		void add(std::uint32_t const id, method_type) {
+			if ( id >= handlers.size() )
+				handlers.resize(id + 1, nullptr);
+			handlers[id] = &detail::handle_message<std::remove_cvref_t<method_type>, service_type>;
+		}; // !add
+
+		//! @brief decodes **request**, calls the handler of **id** and encodes its result into **response**
+		dispatch_result dispatch(std::uint32_t const id, std::span<std::byte const> const request, std::span<std::byte> const response) const {
+			if ( id >= handlers.size() || !handlers[id] )
+				return { dispatch_status::unknown_method, 0 };
+			return handlers[id](*service, request, response);
+		}; // !dispatch
+
+	private:
+		service_type *service;
+		std::vector<handler_type> handlers;
+	}; // !message_dispatcher
+
+	//! @brief encodes a request for **method**
+	//! @param args... one value per parameter of **method**, each implicitly convertible to it without narrowing
+	//! @return the encoded size; or a null **std::optional**, if **out** is too small.
+	template<auto method, typename ... args_t>
+		requires(std::is_member_function_pointer_v<decltype(method)> &&
+			detail::wire_arguments_match<detail::wire_arguments_t<decltype(method)>, args_t...>)
+	std::optional<std::size_t> encode_request(std::span<std::byte> const out, args_t&& ... args) {
+		typedef detail::wire_arguments_t<decltype(method)> wire_tuple;
+		detail::wire_writer writer { out };
+		[&]<std::size_t ... idx>(std::index_sequence<idx...>) {
+			(writer.write<std::tuple_element_t<idx, wire_tuple>>(std::forward<args_t>(args)), ...);
+		}(std::index_sequence_for<args_t...>{});
+		if ( !writer.ok )
+			return std::nullopt;
+		return writer.position;
+	}; // !encode_request
+
+	//! @brief decodes the response of **method**; views point into **in**
+	//! @return the result; or a null **std::optional**, if **in** is malformed.
+	template<auto method>
+		requires(std::is_member_function_pointer_v<decltype(method)> && !std::is_void_v<bct::return_type_t<decltype(method)>>)
+	std::optional<std::remove_cvref_t<bct::return_type_t<decltype(method)>>> decode_response(std::span<std::byte const> const in) {
+		detail::wire_reader reader { in };
+		auto result = reader.template read<std::remove_cvref_t<bct::return_type_t<decltype(method)>>>();
+		if ( !reader.ok || reader.position != in.size() )
+			return std::nullopt;
+		return result;
+	}; // !decode_response
+
+}; // !lib_fm
+
+#endif // !MESSAGE_DISPATCHER_HPP
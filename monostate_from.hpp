@@ -18,6 +18,8 @@
 
 
 #include "functional.hpp"
+#include "trace.hpp"
+#include "symbol_map.hpp"
 
 namespace lib_fm {
 #	include "detail/d_monostate_from.hpp"
@@ -41,7 +43,7 @@ namespace lib_fm {
 	//! @tparam fn the function or member address to be converted
 	template<typename fn_type, fn_type fn>
 		requires is_function_pointer<fn_type> || std::is_member_function_pointer_v<fn_type> //std::is_member_pointer_v<fn_type>
-	struct make_monostate_from_overload //cleans the mess up, concludes the final interface
+	struct LIB_FM_VISIBLE make_monostate_from_overload //cleans the mess up, concludes the final interface
 		: detail::zero_bind<fn_type, fn>
 	{
 		static_assert(fn,"'nullptr' is not acceptable.\n You may want to default construct 'short_function'");
@@ -80,12 +82,12 @@ namespace lib_fm {
 	//! @tparam fn_type signature of the funtion pointer
 	//! @tparam fn name of the overload set
 	template<typename fn_type, fn_type fn>
-	make_monostate_from_overload<fn_type, fn> static constexpr monostate_from_overload; //ultimate tool: used for overloaded functions
+	make_monostate_from_overload<fn_type, fn> inline constexpr monostate_from_overload; //ultimate tool: used for overloaded functions
 
 	//! @brief a zero-sized template variable equivalent to member/function pointer 
 	//! @tparam fn member/function pointer to be optimized for callback libraries
 	template<auto fn>
-	make_monostate_from<fn> static constexpr monostate_from;
+	make_monostate_from<fn> inline constexpr monostate_from;
 	//ultimate tool: simplified for single overload sets
 
 	//! @brief same as ***zbind_front***, but with explicit overload selection parameter for overloaded functions.
@@ -108,7 +110,7 @@ namespace lib_fm {
 	//! @return a callable bound to specified parameters
 	template<typename fn_type, fn_type fn, typename ... bound>
 		requires(std::is_member_pointer_v<fn_type> || is_function_pointer<fn_type>)
-	auto constexpr static zbind_back_v(bound&& ... b) {
+	auto constexpr zbind_back_v(bound&& ... b) {
 		return detail::zbind_back_v<fn_type, fn>(std::forward<bound>(b)...);
 	};//ultimate tool: used for overloaded functions
 
@@ -118,7 +120,7 @@ namespace lib_fm {
 	//! @param ...b parameters to bind in the front
 	//! @return a callable bound to specified parameters
 	template<auto fn, typename ... bound>
-	auto constexpr static zbind_front(bound&& ... b) {
+	auto constexpr zbind_front(bound&& ... b) {
 		return detail::zbind_front_v<decltype(fn), fn>(std::forward<bound>(b)...);
 	};//ultimate tool: simplified for single overload sets
 
@@ -128,7 +130,7 @@ namespace lib_fm {
 	//! @param ...b parameters to bind in the back
 	//! @return a callable bound to specified parameters
 	template<auto fn, typename ... bound>
-	auto constexpr static zbind_back(bound&& ... b) {
+	auto constexpr zbind_back(bound&& ... b) {
 		return detail::zbind_back_v<decltype(fn), fn>(std::forward<bound>(b)...);
 	};//ultimate tool: simplified for single overload sets
 
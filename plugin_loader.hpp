@@ -0,0 +1,196 @@
+#ifndef PLUGIN_LOADER_HPP
+#define PLUGIN_LOADER_HPP
+//! @file plugin_loader.hpp
+//! @brief a header only lazy binder of shared library entry points into *short_function* compatible handles.
+//!
+//! a plugin exports one registration table, an array of *symbol_entry* named 'lib_fm_symbol_table', listing the name, the
+//! signature fingerprint and the address of each entry point. the host names every entry point it uses as an empty callable,
+//! ***plugin_symbol<library, "name", signature>***, that fits in a *short_function*. like a PLT entry, each symbol owns a
+//! pointer slot that initially points at a resolver; the first call looks the name up in the table, verifies the signature,
+//! patches the slot and forwards the call. later calls are a single indirect call through the slot, with no check.
+//! nothing is resolved at load time, however many entry points the plugin has.
+//!
+//! on ELF platforms the manager tables and thunks of *short_function* and *monostate_from* are exported (**LIB_FM_VISIBLE**),
+//! so the same callable type yields one table in the host and its plugins, and *operator==* and *target()* agree across the
+//! boundary. this needs the host's symbols to be visible to the plugin: link the host with -rdynamic, or keep the default
+//! RTLD_GLOBAL. under -fvisibility=hidden the user's own callable and class types must be exported as well, since an
+//! instantiation is never more visible than its template arguments. on Windows each DLL keeps its own copy.
+//!
+//! Example:
+//! @code
+//!	// plugin.cpp, built as a shared library:
+//!	extern "C" LIB_FM_VISIBLE lib_fm::symbol_entry const lib_fm_symbol_table[] = {
+//!		lib_fm::export_symbol<&compress>("compress"),
+//!		{}	// terminator
+//!	};
+//!	// host.cpp:
+//!	struct codec_plugin;
+//!	lib_fm::plugin<codec_plugin>::open("./libcodec.so");
+//!	short_function<std::size_t(std::span<std::byte const>)> compress = plugin_symbol<codec_plugin, "compress", std::size_t(std::span<std::byte const>)>;
+//!	compress(data);	// resolves on first call
+//! @endcode
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#if defined(_WIN32)
+#	ifndef WIN32_LEAN_AND_MEAN
+#		define WIN32_LEAN_AND_MEAN
+#	endif
+#	include <windows.h>
+#else
+#	include <dlfcn.h>
+#endif
+#include "functional.hpp"
+
+namespace lib_fm {
+
+	//! @brief one exported entry point in a plugin's registration table
+	struct symbol_entry {
+		char const		*name;
+		std::uint64_t	signature;
+		void			(*address)();
+	}; // !symbol_entry
+
+	//! @brief name of the registration table a plugin must export
+	char constexpr inline symbol_table_name[] = "lib_fm_symbol_table";
+
+	//! @brief thrown when an entry point is missing, has another signature, or its library is not open
+	struct plugin_error: std::runtime_error { using std::runtime_error::runtime_error; };
+
+	//! @brief builds a registration table entry for **fn**
+	//! @tparam fn the function to export
+	//! @param name the name the host binds it by
+	template<auto fn>
+		requires is_function_pointer<decltype(fn)>
+	symbol_entry export_symbol(char const *const name) noexcept
+	{	return { name, detail::type_id<bct::function_type_t<decltype(fn)>>, reinterpret_cast<void (*)()>(fn) };	};
+
+#	include "detail/d_plugin_loader.hpp"
+
+	template<typename library, detail::fixed_string name, function_prototype signature>
+	struct make_plugin_symbol;
+
+	//! @brief a shared library, identified by the tag type **library**, whose entry points are bound lazily.
+	//! @tparam library any type; distinguishes libraries from one another
+	template<typename library>
+	class plugin {
+	public:
+		//! @brief loads the library and locates its registration table. a previously loaded library is closed first.
+		//! @param path file name passed to the platform loader
+		//! @return **true** on success; **false**, if the library can't be loaded or exports no registration table.
+		static bool open(char const *const path, int const flags = detail::default_open_flags) {
+			close();
+			handle = detail::dl_open(path, flags);
+			if ( !handle )
+				return false;
+			table = reinterpret_cast<symbol_entry const *>(detail::dl_symbol(handle, symbol_table_name));
+			if ( !table )
+				close();
+			return table;
+		}; // !open
+
+		//! @brief unbinds every resolved entry point, then unloads the library
+		static void close() noexcept {
+			for ( auto node = bound.exchange(nullptr); node; node = node->next )
+				node->reset();
+			table = nullptr;
+			if ( handle )
+				detail::dl_close(std::exchange(handle, nullptr));
+		}; // !close
+
+		static bool is_open() noexcept { return table; };
+
+		//! @brief finds **name** in the registration table
+		//! @return the entry; or **nullptr**, if not exported or the library is not open.
+		static symbol_entry const *find(std::string_view const name) noexcept {
+			if ( table )
+				for ( auto entry = table; entry->name; ++entry )
+					if ( name == entry->name )
+						return entry;
+			return nullptr;
+		}; // !find
+
+	private:
+		template<typename, detail::fixed_string, function_prototype>
+		friend struct make_plugin_symbol;
+
+		inline static void *handle = nullptr;
+		inline static symbol_entry const *table = nullptr;
+		inline static std::atomic<detail::bound_symbol *> bound { nullptr };	// resolved slots, reset on close
+	}; // !plugin
+
+	//! @brief an empty callable bound lazily to the entry point **name** of **library**
+	//! @tparam library the tag type of the *plugin*
+	//! @tparam name the exported name
+	//! @tparam signature the expected prototype; checked against the registration table on first call
+	template<typename library, detail::fixed_string name, function_prototype signature>
+	struct make_plugin_symbol:
+		function_crtp_base<make_plugin_symbol<library, name, signature> const, signature>
+	{
+		using base_type = function_crtp_base<make_plugin_symbol const, signature>;
+		using typename base_type::proto_type;
+		using typename base_type::return_type;
+		using typename base_type::argument_tuple;
+		using base_type::argument_count;
+		using base_type::operator();
+		typedef proto_type *function_ptr;
+
+		constexpr auto operator==(make_plugin_symbol const) const noexcept { return true; };
+		constexpr auto operator!=(make_plugin_symbol const) const noexcept { return false; };
+
+		//! @brief binds the entry point without calling it
+		//! @return **true** if bound; **false**, if missing, mismatched or the library is not open.
+		static bool resolve() noexcept { return try_bind(); };
+
+		//! @brief checks if the first call has already happened (or *resolve* succeeded)
+		static bool is_resolved() noexcept { return slot.load(std::memory_order_acquire) != resolve_and_call; };
+
+	private:
+		friend class base_type::function_crtp_base;
+
+		return_type static do_invoke(auto&& ... args)
+		{	return slot.load(std::memory_order_relaxed)(std::forward<decltype(args)>(args)...);	};
+
+		//! initial target of the slot
+		template<typename ... args_t>
+		struct resolver;
+
+		template<typename ... args_t>
+		struct resolver<std::tuple<args_t...>> {
+			static return_type call(args_t ... args) {
+				if ( !try_bind() )
+					throw plugin_error { std::string { "unresolved plugin symbol: " } + name.value };
+				return slot.load(std::memory_order_acquire)(std::forward<args_t>(args)...);
+			};
+		}; // !resolver
+
+		static constexpr function_ptr resolve_and_call = &resolver<argument_tuple>::call;
+
+		static bool try_bind() noexcept {
+			auto const entry = plugin<library>::find(name.value);
+			if ( !entry || entry->signature != detail::type_id<signature> )
+				return false;
+			if ( slot.exchange(reinterpret_cast<function_ptr>(entry->address), std::memory_order_acq_rel) == resolve_and_call ) {
+				node.next = plugin<library>::bound.load(std::memory_order_relaxed);
+				while ( !plugin<library>::bound.compare_exchange_weak(node.next, &node, std::memory_order_release) );
+			};
+			return true;
+		}; // !try_bind
+
+		inline static std::atomic<function_ptr> slot { resolve_and_call };
+		inline static detail::bound_symbol node { +[] { slot.store(resolve_and_call, std::memory_order_release); } };
+	}; // !make_plugin_symbol
+
+	//! @brief a zero-sized handle to a lazily bound plugin entry point
+	//! @tparam library the tag type of the *plugin*
+	//! @tparam name the exported name
+	//! @tparam signature the expected prototype
+	template<typename library, detail::fixed_string name, function_prototype signature>
+	make_plugin_symbol<library, name, signature> inline constexpr plugin_symbol;
+
+}; // !lib_fm
+
+#endif // !PLUGIN_LOADER_HPP
@@ -19,7 +19,7 @@
 namespace lib_fm {
 
 	//! @brief determines the underlying category of a *short_function*
-	enum class short_function_source { 
+	enum class LIB_FM_VISIBLE short_function_source { 
 		//! @brief when a short function is default constructed
 		none,
 		//! @brief when a short function is evaluated to a 'monostate_from' on a static function
@@ -49,7 +49,7 @@ namespace lib_fm {
 	//! @tparam signature the commont function prototype of all the functions that it can hold 
 	//! @requires the 'signature' to satisfy 'std::is_function'
 	template<function_prototype signature/*, bool denied= true*/>
-	struct short_function:
+	struct LIB_FM_VISIBLE short_function:
 		detail::short_function_def<short_function<signature>,signature>
 	{
 		typedef detail::short_function_def<short_function, signature>	base_type;
@@ -116,7 +116,7 @@ namespace lib_fm {
 		//! provides a mechanism to use **short_function** as a valid input to old C call back API. regardless of the underlying
 		//! type-erased function, a free function pointer representation exists for all trivial empty function objects
 		//! @{
-		auto constexpr to_ptr() const noexcept { command_query<short_function_command::callable>(); };
+		auto constexpr to_ptr() const noexcept { return command_query<short_function_command::callable>(); };
 		constexpr explicit operator free_pointer() const { return to_ptr(); };
 		//! @}
 
@@ -129,8 +129,10 @@ namespace lib_fm {
 		//! @return **true** iff the official parameter set and return type match; **false** otherwise.
 		bool constexpr is_converted() const noexcept { return !(command_query<short_function_command::exact_match>()); };
 
-		friend bool operator==(short_function const &, short_function const &) noexcept = default;
-		friend bool operator!=(short_function const &, short_function const &) noexcept = default;
+		//! @brief equal iff both hold the same type-erased function. compares the managers only: a defaulted comparison would
+		//! recurse, since the empty base is itself convertible to *short_function*.
+		friend bool constexpr operator==(short_function const &left, short_function const &right) noexcept
+		{	return left.manager == right.manager;	};
 
 		//! @brief type un-erasure. tries to retrive to the original empty function object or function/member pointer.
 		//! this function can retrive an empty function object; or a function/member pointer in case the stored function was a **monostate_from**
@@ -170,8 +172,10 @@ namespace lib_fm {
 
 		friend class base_type::function_crtp_base; // uses:
 
-		return_type do_invoke(auto&&...args) const
-		{	return this -> template command_query<short_function_command::callable>()(std::forward<decltype(args)>(args)...);	};
+		return_type do_invoke(auto&&...args) const {
+			LIB_FM_TRACE_SCOPE(short_function, manager);
+			return this -> template command_query<short_function_command::callable>()(std::forward<decltype(args)>(args)...);
+		}; // !do_invoke
 
 		template <short_function_command command>
 		auto constexpr command_query() const noexcept { return this->template command_query<command>(manager); };
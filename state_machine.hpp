@@ -0,0 +1,125 @@
+#ifndef STATE_MACHINE_HPP
+#define STATE_MACHINE_HPP
+//! @file state_machine.hpp
+//! @brief a header only table-driven finite state machine with *monostate_from* transition actions.
+//!
+//! the transition table '(state, event) -> (action, next state)' is listed as 'transition<...>' types and compiled into a dense
+//! constant array of free function pointers, one row per state and one column per event. dispatching an event is one
+//! indexed load and one indirect call, with no branch: pairs missing from the list keep the state and call a no-op.
+//! actions are empty callables, typically ***monostate_from<&parser::on_x>***, invoked as action(context&, event const&)
+//! or, if they don't take the event, as action(context&).
+//! states and events are enumerations with a trailing 'count' enumerator, or with *enum_size* specialized. an event may also
+//! be a class carrying its enumeration in a public member named 'id', so that actions get the payload.
+//!
+//! Example:
+//! @code
+//!	enum class state { idle, header, body, count };
+//!	enum class input { start, field, end, count };
+//!	using machine = state_machine<parser, state, input,
+//!		transition<state::idle, input::start, monostate_from<&parser::on_start>, state::header>,
+//!		transition<state::header, input::field, monostate_from<&parser::on_field>, state::header>,
+//!		transition<state::header, input::end, nullptr, state::body>>;
+//!	machine fsm { parser_object, state::idle };
+//!	fsm.feed(std::span { inputs });
+//! @endcode
+
+#include <array>
+#include <span>
+#include <cstddef>
+#include <utility>
+#include "functional.hpp"
+
+namespace lib_fm {
+
+	//! @brief number of enumerators of a state or event enumeration; defaults to the value of its 'count' enumerator
+	template<typename enum_type>
+		requires std::is_enum_v<enum_type>
+	std::size_t constexpr inline enum_size = static_cast<std::size_t>(enum_type::count);
+
+	//! @brief one row of the transition table
+	//! @tparam from the source state
+	//! @tparam on the triggering event id
+	//! @tparam action an empty callable run on the transition; **nullptr** for none
+	//! @tparam to the target state
+	template<auto from, auto on, auto action, auto to>
+		requires(std::is_enum_v<decltype(from)> && std::is_enum_v<decltype(on)> && std::is_same_v<decltype(from), decltype(to)>)
+	struct transition {
+		auto static constexpr source = from;
+		auto static constexpr event = on;
+		auto static constexpr function = action;
+		auto static constexpr target = to;
+	}; // !transition
+
+#	include "detail/d_state_machine.hpp"
+
+	//! @brief a state machine over a dense, constant transition table
+	//! @tparam context the object the actions operate on
+	//! @tparam state_type enumeration of the states
+	//! @tparam event_type enumeration of the events; or a class with such an enumeration as member 'id'
+	//! @tparam transitions... *transition* rows; at most one per (state, event) pair
+	template<typename context, typename state_type, typename event_type, typename ... transitions>
+		requires(std::is_enum_v<state_type> && (... && std::is_same_v<decltype(transitions::source), state_type const>))
+	class state_machine {
+		typedef detail::event_id_t<event_type> id_type;
+		std::size_t static constexpr state_count = enum_size<state_type>;
+		std::size_t static constexpr event_count = enum_size<id_type>;
+
+		static constexpr std::size_t cell(state_type const state, id_type const id) noexcept
+		{	return static_cast<std::size_t>(state) * event_count + static_cast<std::size_t>(id);	};
+
+		static constexpr bool unique_rows() noexcept {
+			std::array<bool, state_count * event_count> seen {};
+			return (true && ... && !std::exchange(seen[cell(transitions::source, transitions::event)], true));
+		}; // !unique_rows
+
+		static_assert((... && std::is_same_v<decltype(transitions::event), id_type const>), "transition events must be of the event id type");
+		static_assert(unique_rows(), "at most one transition per (state, event) pair");
+
+	public:
+		typedef void (*action_type)(context &, event_type const &);
+
+		//! @brief a table cell
+		struct entry {
+			action_type	action;
+			state_type	next;
+		}; // !entry
+
+		//! @brief the dense table, indexed by state * event_count + event
+		static constexpr auto table = [] {
+			std::array<entry, state_count * event_count> result {};
+			for ( std::size_t s = 0; s < state_count; ++s )
+				for ( std::size_t e = 0; e < event_count; ++e )
+					result[s * event_count + e] = { &detail::ignore_event<context, event_type>, static_cast<state_type>(s) };
+			((result[cell(transitions::source, transitions::event)] =
+				{ &detail::transition_action<transitions::function, context, event_type>, transitions::target }), ...);
+			return result;
+		}();
+
+		constexpr state_machine(context &object, state_type const initial) noexcept: object { &object }, current { initial } {};
+
+		//! @brief processes one event: moves to the next state, then runs the action
+		void feed(event_type const &event) {
+			entry const &row = table[cell(current, detail::event_id(event))];
+			current = row.next;
+			row.action(*object, event);
+		}; // !feed
+
+		//! @brief processes a stream of events in order
+		//! @return the state after the last event
+		state_type feed(std::span<event_type const> const events) {
+			for ( auto const &event : events )
+				feed(event);
+			return current;
+		}; // !feed
+
+		state_type state() const noexcept { return current; };
+		void reset(state_type const state) noexcept { current = state; };
+
+	private:
+		context		*object;
+		state_type	current;
+	}; // !state_machine
+
+}; // !lib_fm
+
+#endif // !STATE_MACHINE_HPP
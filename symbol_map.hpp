@@ -0,0 +1,115 @@
+#ifndef SYMBOL_MAP_HPP
+#define SYMBOL_MAP_HPP
+//! @file symbol_map.hpp
+//! @brief an opt-in registry naming the thunks and manager tables generated for *short_function* and *monostate_from*.
+//!
+//! build with **LIB_FM_SYMBOL_MAP**=1 (the same value in every translation unit) and each generated thunk and manager is
+//! recorded, once, when first created: its address, and a readable name made of its role, its *short_function_source*, the
+//! erased type and the signature. records come from the manager tables, the thunks of *tuple_manager*, the target of
+//! each *monostate_from* called, and the member thunk of the *monostate_from* conversion to function pointer.
+//! - *write_perf_map* writes the thunks in the '/tmp/perf-<pid>.map' format ('start size name' per line, hex). perf only
+//!   consults it for addresses outside any mapped image, so for thunks of a non-stripped binary it's mostly a cross reference;
+//!   thunk sizes are estimates.
+//! - *write_symbol_map* writes every record as JSON, which also resolves the ids of *trace_flush* events.
+//! with **LIB_FM_SYMBOL_MAP**=0 (the default) nothing is recorded, the functions below are empty, and *symbol_record* and
+//! *symbol_map_entries* are not declared, so that their <string> and <vector> dependencies aren't pulled in either.
+//!
+//! Example:
+//! @code
+//!	run_workload();
+//!	lib_fm::write_perf_map();	// before perf report
+//! @endcode
+
+#ifndef LIB_FM_SYMBOL_MAP
+#	define LIB_FM_SYMBOL_MAP 0
+#endif
+
+#include <cstddef>
+#include <iosfwd>
+#if LIB_FM_SYMBOL_MAP
+#	include <cstdint>
+#	include <fstream>
+#	include <mutex>
+#	include <ostream>
+#	include <string>
+#	include <string_view>
+#	include <vector>
+#	if defined(_WIN32)
+#		include <process.h>
+#	else
+#		include <unistd.h>
+#	endif
+#endif
+#include "functional.hpp"
+
+namespace lib_fm {
+
+	//! @brief what a symbol record names
+	enum class symbol_kind {
+		//! @brief a manager table or function; the id of *short_function* trace events
+		manager,
+		//! @brief generated code: a forwarding thunk
+		thunk,
+		//! @brief the 'target_function' of a *monostate_from*; the id of its trace events
+		target
+	}; // !symbol_kind
+
+#if LIB_FM_SYMBOL_MAP
+
+	//! @brief one named address
+	struct symbol_record {
+		void const	*address;
+		std::size_t	size;
+		symbol_kind	kind;
+		std::string	name;
+	}; // !symbol_record
+
+#	include "detail/d_symbol_map.hpp"
+
+	//! @brief a snapshot of the records so far
+	inline std::vector<symbol_record> symbol_map_entries() {
+		auto &shared = detail::symbols();
+		std::lock_guard const lock { shared.mutex };
+		return shared.records;
+	}; // !symbol_map_entries
+
+	//! @brief writes the thunks recorded so far in the perf map format, replacing the file
+	//! @param path the output file; **nullptr** for '/tmp/perf-<pid>.map'
+	//! @return **false**, if the file can't be written
+	inline bool write_perf_map(char const *const path = nullptr) {
+		std::ofstream file { path ? std::string { path } : "/tmp/perf-" + std::to_string(detail::process_id()) + ".map", std::ios::trunc };
+		if ( !file )
+			return false;
+		file << std::hex;
+		for ( auto const &record : symbol_map_entries() )
+			if ( record.kind == symbol_kind::thunk )
+				file << reinterpret_cast<std::uintptr_t>(record.address) << ' ' << record.size << ' ' << record.name << '\n';
+		return static_cast<bool>(file.flush());
+	}; // !write_perf_map
+
+	//! @brief writes every record as a JSON document: {"symbols":[{"address","size","kind","name"}...]}
+	//! @return the number of records written
+	inline std::size_t write_symbol_map(std::ostream &out) {
+		auto const records = symbol_map_entries();
+		std::string_view constexpr kinds[] = { "manager", "thunk", "target" };
+		out << "{\"symbols\":[";
+		for ( std::size_t i = 0; i != records.size(); ++i ) {
+			out << (i ? ",\n" : "\n") << "{\"address\":\"" << records[i].address << "\",\"size\":" << std::dec << records[i].size
+				<< ",\"kind\":\"" << kinds[static_cast<std::size_t>(records[i].kind)] << "\",\"name\":";
+			detail::write_json_string(out, records[i].name);
+			out << '}';
+		};
+		out << "\n]}\n";
+		return records.size();
+	}; // !write_symbol_map
+
+#else
+
+	inline bool write_perf_map(char const *const = nullptr) { return false; };
+	inline std::size_t write_symbol_map(std::ostream &) { return 0; };
+
+#endif // LIB_FM_SYMBOL_MAP
+
+}; // !lib_fm
+
+#endif // !SYMBOL_MAP_HPP
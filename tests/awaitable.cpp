@@ -0,0 +1,82 @@
+// awaitable.cpp : synchronous and asynchronous completions, completions from another thread, and FIFO wake-up order.
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "../awaitable.hpp"
+using namespace lib_fm;
+
+typedef short_function<void(void *, int)> context_callback;
+
+//! completes before returning: the awaiter must not suspend
+void immediate(int const x, context_callback const done, void *const context) { done(context, x + 1); };
+
+//! completes later, from another thread
+std::vector<std::thread> workers;
+void threaded(int const x, context_callback const done, void *const context) {
+	workers.emplace_back([=] {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		done(context, x * 2);
+	});
+};
+
+task<int> context_chain(int const x) {
+	int const a = co_await await_context_callback<int>([](int x, context_callback done, void *c) { immediate(x, done, c); }, x);
+	int const b = co_await await_context_callback<int>([](int x, context_callback done, void *c) { threaded(x, done, c); }, a);
+	co_return b + 1;
+};
+
+task<int> nested(int const x) {
+	int total = 0;
+	for ( int i = 0; i < 8; ++i )
+		total += co_await context_chain(x + i);
+	co_return total;
+};
+
+//! a same-thread API: completions are posted to the loop and delivered in the order the operations started
+run_loop *loop_ptr = nullptr;
+void posted(int const x, short_function<void(int)> const done) {
+	struct pending { short_function<void(int)> done; int x; };
+	loop_ptr->post([](void *p) {
+		auto const op = static_cast<pending *>(p);
+		op->done(op->x);
+		delete op;
+	}, new pending { done, x });
+};
+
+task<int> fifo_one(int const x, std::vector<int> &order) {
+	int const y = co_await await_callback<int>([](int x, short_function<void(int)> done) { posted(x, done); }, x);
+	order.push_back(y);
+	co_return y;
+};
+
+task<> fifo_many(run_loop &loop, std::vector<int> &order) {
+	std::vector<task<int>> started;
+	for ( int i = 0; i < 4; ++i )
+		started.push_back(fifo_one(i, order));
+	for ( auto &t : started )
+		co_await std::move(t);
+	co_await loop.schedule();
+};
+
+int main() {
+	run_loop loop;
+	loop_ptr = &loop;
+
+	assert(sync_wait(loop, context_chain(3)) == (3 + 1) * 2 + 1);
+	int expected = 0;
+	for ( int i = 0; i < 8; ++i )
+		expected += (10 + i + 1) * 2 + 1;
+	assert(sync_wait(loop, nested(10)) == expected);
+
+	std::vector<int> order;
+	sync_wait(loop, fifo_many(loop, order));
+	assert((order == std::vector<int> { 0, 1, 2, 3 }));
+
+	for ( auto &worker : workers )
+		worker.join();
+	std::cout << "awaitable: ok\n";
+	return EXIT_SUCCESS;
+};
@@ -0,0 +1,120 @@
+// call_queue.cpp : batch semantics of spsc_queue and mpmc_queue, including partial batches, and cross-thread handoff.
+#include <cassert>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <thread>
+#include <vector>
+#include "../call_queue.hpp"
+using namespace lib_fm;
+
+template<typename queue_type>
+std::vector<int> drain(queue_type &queue, std::size_t const batch) {
+	std::vector<int> result;
+	while ( queue.try_pop_n(batch, [&result](int value) { result.push_back(value); }) );
+	return result;
+};
+
+template<typename queue_type>
+void partial_batches() {
+	queue_type queue;
+	std::vector<int> values(12);
+	std::iota(values.begin(), values.end(), 0);
+
+	assert(queue.try_pop_n(4, [](int) { assert(false); }) == 0);			// empty
+	assert(queue.try_push_n(values.begin(), 0) == 0 && queue.empty());	// zero counts, on a queue that isn't full...
+	assert(queue.try_push_n(values.begin(), 12) == 8);						// clipped to capacity
+	assert(!queue.try_push(100));											// full
+	assert(queue.try_push_n(values.begin(), 3) == 0);
+
+	std::vector<int> popped;
+	assert(queue.try_pop_n(0, [](int) { assert(false); }) == 0);			// ...nor empty
+	assert(queue.try_pop_n(3, [&popped](int value) { popped.push_back(value); }) == 3);
+	assert((popped == std::vector<int> { 0, 1, 2 }));
+	assert(queue.try_push_n(values.begin() + 8, 4) == 3);					// only 3 cells free
+	assert(queue.size() == 8);
+
+	auto const rest = drain(queue, 100);									// clipped to what's there
+	assert((rest == std::vector<int> { 3, 4, 5, 6, 7, 8, 9, 10 }));
+	assert(queue.empty() && !queue.try_pop());
+};
+
+void add(int &total, int const value) { total += value; };
+
+template<typename queue_type>
+void deferred_calls() {
+	queue_type queue;
+	int total = 0;
+	for ( int i = 1; i <= 10; ++i )
+		assert(queue.try_emplace(monostate_from<&add>, std::ref(total), i));
+	assert(run(queue, 4) == 4 && total == 1 + 2 + 3 + 4);
+	assert(run(queue, 100) == 6 && total == 55);
+	assert(run(queue, 1) == 0);
+	assert(queue.try_emplace(monostate_from<&add>, std::ref(total), 1));
+	assert(run(queue, 0) == 0 && total == 55 && !queue.empty());
+};
+
+void spsc_threads(int const count) {
+	spsc_queue<int, 64> queue;
+	std::thread producer { [&queue, count] {
+		std::vector<int> batch;
+		for ( int next = 0; next < count; ) {
+			batch.clear();
+			for ( int i = 0; i < 1 + next % 7 && next + i < count; ++i )
+				batch.push_back(next + i);
+			next += static_cast<int>(queue.try_push_n(batch.begin(), batch.size()));
+			std::this_thread::yield();
+		};
+	} };
+	int expected = 0;
+	while ( expected < count )
+		if ( !queue.try_pop_n(1 + expected % 5, [&expected](int value) { assert(value == expected); ++expected; }) )
+			std::this_thread::yield();
+	producer.join();
+	assert(queue.empty());
+};
+
+void mpmc_threads(int const producers, int const consumers, int const per_producer) {
+	mpmc_queue<int, 128> queue;
+	std::vector<std::atomic<int>> seen(static_cast<std::size_t>(producers * per_producer));
+	std::atomic<int> remaining { producers * per_producer };
+	std::vector<std::thread> threads;
+	for ( int p = 0; p < producers; ++p )
+		threads.emplace_back([&queue, p, per_producer] {
+			std::vector<int> batch;
+			for ( int next = 0; next < per_producer; ) {
+				batch.clear();
+				for ( int i = 0; i < 1 + next % 9 && next + i < per_producer; ++i )
+					batch.push_back(p * per_producer + next + i);
+				if ( auto const pushed = queue.try_push_n(batch.begin(), batch.size()) )
+					next += static_cast<int>(pushed);
+				else
+					std::this_thread::yield();
+			};
+		});
+	for ( int c = 0; c < consumers; ++c )
+		threads.emplace_back([&] {
+			while ( remaining.load() > 0 )
+				if ( auto const popped = queue.try_pop_n(1 + c % 4, [&seen](int value) { seen[value].fetch_add(1); }) )
+					remaining.fetch_sub(static_cast<int>(popped));
+				else
+					std::this_thread::yield();
+		});
+	for ( auto &thread : threads )
+		thread.join();
+	for ( auto const &count : seen )
+		assert(count.load() == 1);												// each value exactly once
+	assert(queue.empty());
+};
+
+int main() {
+	partial_batches<spsc_queue<int, 8>>();
+	partial_batches<mpmc_queue<int, 8>>();
+	deferred_calls<spsc_call_queue<void(int &, int), 16>>();
+	deferred_calls<mpmc_call_queue<void(int &, int), 16>>();
+	spsc_threads(200'000);
+	mpmc_threads(4, 4, 50'000);
+	std::cout << "call_queue: ok\n";
+	return EXIT_SUCCESS;
+};
@@ -0,0 +1,46 @@
+// cpu_dispatch.cpp : each variant can be forced through select(), and the dispatched entry points work before main.
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include "../cpu_dispatch.hpp"
+using namespace lib_fm;
+
+int wide(int const x) { return x + 3000; };
+int fused(int const x) { return x + 2000; };
+int scalar(int const x) { return x + 1000; };
+
+using offset = cpu_dispatch<int(int),
+	dispatch_variant<cpu_feature::avx512f | cpu_feature::avx512bw, &wide>,
+	dispatch_variant<cpu_feature::avx2 | cpu_feature::fma, &fused>,
+	dispatch_variant<cpu_feature::sse2, &scalar>>;
+
+//! dynamically initialized in this translation unit, possibly before anything cpu_dispatch sets up itself
+int const early = offset::pointer(1);
+short_function<int(int)> const early_function = offset::function;
+
+template<auto fn>
+bool selects(cpu_feature const available) {
+	auto const chosen = offset::select(available).target<decltype(fn)>();
+	return chosen && *chosen == fn;
+};
+
+int main() {
+	// forcing every variant:
+	assert(selects<&wide>(cpu_feature::avx512f | cpu_feature::avx512bw | cpu_feature::avx2 | cpu_feature::fma));
+	assert(selects<&wide>(cpu_feature::avx512f | cpu_feature::avx512bw));
+	assert(selects<&fused>(cpu_feature::avx512f | cpu_feature::avx2 | cpu_feature::fma));	// avx512bw missing
+	assert(selects<&fused>(cpu_feature::avx2 | cpu_feature::fma | cpu_feature::sse2));
+	assert(selects<&scalar>(cpu_feature::avx2 | cpu_feature::sse2));						// fma missing
+	assert(selects<&scalar>(cpu_feature::sse2));
+	assert(selects<&scalar>(cpu_feature::none));											// the last variant is the fallback
+	assert(offset::index(cpu_feature::none) == 2 && offset::index(cpu_feature::avx512f | cpu_feature::avx512bw) == 0);
+	assert(offset::select(cpu_feature::sse2)(1) == 1001);
+
+	// the dispatched entry points agree with select() on this CPU, including the calls made before main:
+	int const expected = offset::select(detected_cpu_features())(1);
+	assert(early == expected);
+	assert(early_function(1) == expected);
+	assert(offset::pointer(1) == expected && offset::function(1) == expected);
+	std::cout << "cpu_dispatch: ok (variant " << offset::index(detected_cpu_features()) << " on this CPU)\n";
+	return EXIT_SUCCESS;
+};
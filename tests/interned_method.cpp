@@ -0,0 +1,87 @@
+// interned_method.cpp : one record per distinct member pointer, handles from monostate_from, calls through virtual bases
+// and virtual members, null handles and the opaque address round trip.
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include "../interned_method.hpp"
+using namespace lib_fm;
+
+struct base {
+	virtual ~base() = default;
+	virtual int get(int const x) const { return value + x; };
+	int value = 1;
+}; // !base
+
+struct left: virtual base { int left_value = 10; };
+struct right: virtual base { int get(int const x) const override { return -x; }; };
+
+//! member pointers of a class with virtual bases: the widest representation
+struct derived: left, right {
+	int twice(int const x) const { return 2 * (value + left_value + x); };
+	int offset(int const x) const { return value + x; };
+}; // !derived
+
+typedef int (derived::*method)(int) const;
+typedef int (base::*virtual_method)(int) const;
+
+static_assert(sizeof(interned_method<method>) == sizeof(void *));
+static_assert(sizeof(interned_method<virtual_method>) == sizeof(void *));
+
+void deduplication() {
+	auto const count = interned_method<method>::interned_count();
+	auto const twice = intern(&derived::twice);
+	assert(twice == intern(&derived::twice) && twice.target() == &derived::twice);
+	assert(interned_method<method>::interned_count() == count + 1);		// equal pointers share a record
+
+	auto const offset = intern(&derived::offset);
+	assert(offset != twice && interned_method<method>::interned_count() == count + 2);
+
+	// a monostate_from converts to the same handle, whether it comes first or not
+	assert(interned_method<method> { monostate_from<&derived::twice> } == twice);
+	interned_method<method> const late { monostate_from<&derived::offset> };
+	assert(late == offset && interned_method<method>::interned_count() == count + 2);
+};
+
+void calls() {
+	derived object;
+	object.value = 2;
+	auto const twice = intern(&derived::twice);
+	assert(twice(object, 3) == 2 * (2 + 10 + 3));							// this adjusted through the virtual base
+	assert(intern(&derived::offset)(object, 3) == 5);
+
+	// virtual members dispatch on the object, not on the class named by the pointer
+	interned_method<virtual_method> const get { &base::get };
+	base const plain;
+	assert(get(plain, 3) == 1 + 3);
+	assert(get(static_cast<base const &>(object), 3) == -3);
+	assert(intern(static_cast<method>(&derived::get))(object, 3) == -3);
+};
+
+void null_handles() {
+	auto const count = interned_method<method>::interned_count();
+	interned_method<method> const null;
+	assert(!null && null.target() == nullptr && null.address() == nullptr);
+	assert(intern(method { nullptr }) == null);
+	assert(interned_method<method>::interned_count() == count);			// nothing interned
+	assert(null != intern(&derived::twice));
+	assert(interned_method<method>::from_address(nullptr) == null);
+};
+
+void addresses() {
+	derived object;
+	auto const twice = intern(&derived::twice);
+	void const *const address = twice.address();
+	assert(address != nullptr && address == intern(&derived::twice).address());
+	auto const restored = interned_method<method>::from_address(address);
+	assert(restored == twice && restored.target() == &derived::twice);
+	assert(restored(object, 0) == twice(object, 0));
+};
+
+int main() {
+	deduplication();
+	calls();
+	null_handles();
+	addresses();
+	std::cout << "interned_method: ok\n";
+	return EXIT_SUCCESS;
+};
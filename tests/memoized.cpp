@@ -0,0 +1,66 @@
+// memoized.cpp : keys outlive their arguments, eviction keeps the index consistent, and counters add up.
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include "../memoized.hpp"
+#include "../short_function.hpp"
+using namespace lib_fm;
+
+int calls = 0;
+std::size_t length(std::string_view const text) { ++calls; return text.size(); };
+int square(int const x) { ++calls; return x * x; };
+
+// the shards split the capacity evenly, so it is an exact bound: capacities that don't divide are refused
+template<std::size_t capacity, std::size_t shards>
+concept memoizable = requires { typename make_memoized<&square, memo_eviction::lru, capacity, shards>; };
+static_assert(memoizable<1024, 16> && memoizable<64, 4> && memoizable<7, 7>);
+static_assert(!memoizable<1000, 16> && !memoizable<4, 8> && !memoizable<16, 0>);
+
+void string_view_keys() {
+	short_function<std::size_t(std::string_view)> const f = memoized<&length>;
+	calls = 0;
+	for ( int round = 0; round < 2; ++round )
+		for ( int i = 0; i < 100; ++i )
+			assert(f(std::string(40 + i, 'x')) == 40u + i);	// the argument is gone once each call returns
+	assert(calls == 100);
+	auto const [hits, misses, evictions] = memoized<&length>.statistics();
+	assert(hits == 100 && misses == 100 && evictions == 0);
+};
+
+template<memo_eviction policy>
+void eviction() {
+	auto const f = memoized<&square, policy, 64, 4>;
+	calls = 0;
+	for ( int round = 0; round < 3; ++round )
+		for ( int i = 0; i < 10'000; ++i )			// far more keys than slots: every insert past the first 64 evicts
+			assert(f(i % 5'000) == (i % 5'000) * (i % 5'000));
+	auto const [hits, misses, evictions] = f.statistics();
+	assert(hits + misses == 30'000 && misses == static_cast<std::uint64_t>(calls));
+	assert(evictions == misses - 64);							// all 64 slots fill before the first eviction
+	f.clear();
+	calls = 0;
+	assert(f(7) == 49 && f(7) == 49 && calls == 1);
+};
+
+void lru_order() {
+	auto const f = memoized<&square, memo_eviction::lru, 2, 1>;
+	calls = 0;
+	f(1); f(2); f(1);								// 2 is now the least recently used
+	f(3);											// evicts 2
+	assert(calls == 3);
+	f(1);
+	assert(calls == 3);
+	f(2);
+	assert(calls == 4);
+};
+
+int main() {
+	string_view_keys();
+	eviction<memo_eviction::lru>();
+	eviction<memo_eviction::clock>();
+	lru_order();
+	std::cout << "memoized: ok\n";
+	return EXIT_SUCCESS;
+};
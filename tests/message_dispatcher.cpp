@@ -0,0 +1,114 @@
+// message_dispatcher.cpp : loopback of encode_request -> dispatch -> decode_response, and each failure status.
+#include <array>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <string_view>
+#include "../message_dispatcher.hpp"
+using namespace lib_fm;
+
+struct service {
+	std::string_view echo(std::string_view const text) { ++calls; return text; };
+	std::uint64_t sum(std::span<std::uint32_t const> const values) const { return std::accumulate(values.begin(), values.end(), std::uint64_t {}); };
+	double scale(double const x, int const &factor) const { return x * factor; };
+	void reset() { calls = 0; };
+	int calls = 0;
+}; // !service
+
+enum : std::uint32_t { echo_id, sum_id, scale_id, reset_id };
+
+// only const spans of dynamic extent are encoded; other spans would travel as a bare pointer
+static_assert(detail::wire_type<std::span<std::uint32_t const>>);
+static_assert(!detail::wire_type<std::span<std::uint32_t const, 5>>);
+static_assert(!detail::wire_type<std::span<std::uint32_t>>);
+
+// arguments convert implicitly and without narrowing, one per parameter
+template<auto method, typename ... args_t>
+concept encodable = requires(std::span<std::byte> const out, args_t ... args) { encode_request<method>(out, args...); };
+static_assert(encodable<&service::scale, double, int> && encodable<&service::scale, float, short>);
+static_assert(encodable<&service::echo, char const *>);
+static_assert(!encodable<&service::scale, double, double>);		// narrowing
+static_assert(!encodable<&service::scale, double, int *>);		// pointer
+static_assert(!encodable<&service::echo, int>);
+static_assert(!encodable<&service::scale, double> && !encodable<&service::scale, double, int, int>);
+
+int main() {
+	service object;
+	message_dispatcher<service> dispatcher { object };
+	dispatcher.add(echo_id, monostate_from<&service::echo>);
+	dispatcher.add(sum_id, monostate_from<&service::sum>);
+	dispatcher.add(scale_id, monostate_from<&service::scale>);
+	dispatcher.add(reset_id, monostate_from<&service::reset>);
+
+	alignas(8) std::array<std::byte, 256> request;
+	alignas(8) std::array<std::byte, 256> response;
+	auto const call = [&](std::uint32_t const id, std::size_t const size, std::size_t const response_size = 256)
+	{	return dispatcher.dispatch(id, std::span { request }.first(size), std::span { response }.first(response_size));	};
+
+	// string_view in and out:
+	auto size = encode_request<&service::echo>(request, std::string_view { "user:42" });
+	assert(size && *size == 4 + 7);
+	auto result = call(echo_id, *size);
+	assert(result.status == dispatch_status::ok && result.written == 4 + 7);
+	assert(decode_response<&service::echo>(std::span { response }.first(result.written)) == std::string_view { "user:42" });
+
+	// span of dynamic extent, aligned after the count:
+	std::uint32_t const values[] { 1, 2, 3, 4, 5 };
+	size = encode_request<&service::sum>(request, std::span<std::uint32_t const> { values });
+	assert(size && *size == 4 + 5 * 4);
+	result = call(sum_id, *size);
+	assert(result.status == dispatch_status::ok && decode_response<&service::sum>(std::span { response }.first(result.written)) == 15u);
+
+	// trivially copyable values, one taken by const reference:
+	size = encode_request<&service::scale>(request, 1.5, 4);
+	result = call(scale_id, *size);
+	assert(result.status == dispatch_status::ok && decode_response<&service::scale>(std::span { response }.first(result.written)) == 6.0);
+
+	// void result: nothing written
+	size = encode_request<&service::reset>(request);
+	assert(size && *size == 0);
+	assert(object.calls != 0);
+	result = call(reset_id, 0);
+	assert(result.status == dispatch_status::ok && result.written == 0 && object.calls == 0);
+
+	// malformed: truncated, trailing bytes, a count beyond the buffer, a span that can't be aligned
+	size = encode_request<&service::echo>(request, std::string_view { "hello" });
+	assert(call(echo_id, *size - 1).status == dispatch_status::malformed);
+	assert(call(echo_id, *size + 1).status == dispatch_status::malformed);
+	assert(call(echo_id, 2).status == dispatch_status::malformed);
+	size = encode_request<&service::sum>(request, std::span<std::uint32_t const> { values });
+	std::uint32_t const huge = 1u << 30;
+	std::memcpy(request.data(), &huge, sizeof huge);
+	assert(call(sum_id, *size).status == dispatch_status::malformed);
+	assert(call(scale_id, sizeof(double)).status == dispatch_status::malformed);
+	assert(object.calls == 0);											// no handler ran
+	{
+		encode_request<&service::sum>(std::span { request }.subspan(1), std::span<std::uint32_t const> { values });
+		auto const misaligned = dispatcher.dispatch(sum_id, std::span { request }.subspan(1, 4 + 5 * 4), response);
+		assert(misaligned.status == dispatch_status::malformed);
+	};
+
+	// overflow: the handler runs, but its result doesn't fit
+	size = encode_request<&service::echo>(request, std::string_view { "a longer text" });
+	result = call(echo_id, *size, 8);
+	assert(result.status == dispatch_status::overflow && result.written == 0 && object.calls == 1);
+
+	// a request that doesn't fit is refused by the encoder
+	assert(!encode_request<&service::echo>(std::span { request }.first(6), std::string_view { "hello" }));
+
+	// unknown method: a gap in the table, and an id past its end
+	message_dispatcher<service> sparse { object };
+	sparse.add(3, monostate_from<&service::reset>);
+	assert(sparse.dispatch(1, {}, response).status == dispatch_status::unknown_method);
+	assert(sparse.dispatch(1000, {}, response).status == dispatch_status::unknown_method);
+	assert(sparse.dispatch(3, {}, response).status == dispatch_status::ok);
+
+	// a truncated response doesn't decode
+	size = encode_request<&service::echo>(request, std::string_view { "abc" });
+	result = call(echo_id, *size);
+	assert(!decode_response<&service::echo>(std::span { response }.first(result.written - 1)));
+
+	std::cout << "message_dispatcher: ok\n";
+	return EXIT_SUCCESS;
+};
@@ -0,0 +1,20 @@
+// import.cpp : smoke test of the lib_fm module: a program that imports it and calls through short_function and
+// monostate_from.
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+import lib_fm;
+
+struct foo {
+	int bazz(int const x) const { return value + x; };
+	int value = 1;
+}; // !foo
+
+int main() {
+	foo const object;
+	lib_fm::short_function<int(foo const &, int)> const f = lib_fm::monostate_from<&foo::bazz>;
+	assert(f(object, 2) == 3);
+	assert(lib_fm::monostate_from<&foo::bazz>(object, 3) == 4);
+	std::cout << "module: ok\n";
+	return EXIT_SUCCESS;
+};
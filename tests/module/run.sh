@@ -0,0 +1,30 @@
+#!/bin/sh
+# builds the lib_fm module interface and a program importing it, and runs the program; skipped unless the compiler can
+# import named modules (GCC 14 or Clang 16 onwards; GCC 12 builds the interface but can't import it).
+# usage: tests/module/run.sh	(CXX and CXXFLAGS are honoured)
+set -e
+cd "$(dirname "$0")"
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:-"-std=c++20 -O2 -g -Wall -Wextra -pthread"}
+version=$($CXX -dumpversion | cut -d. -f1)
+case "$($CXX --version | head -n 1)" in
+	*clang*) compiler=clang; minimum=16 ;;
+	*) compiler=gcc; minimum=14 ;;
+esac
+if [ "$version" -lt $minimum ]; then
+	echo "== module: skipped ($compiler $version can't import named modules)"
+	exit 0
+fi
+mkdir -p build
+cd build
+if [ $compiler = clang ]; then
+	$CXX $CXXFLAGS -I../../.. -x c++-module --precompile ../../../lib_fm.ixx -o lib_fm.pcm
+	$CXX $CXXFLAGS -c lib_fm.pcm -o lib_fm.o
+	$CXX $CXXFLAGS -fmodule-file=lib_fm=lib_fm.pcm -c ../import.cpp -o import.o
+else
+	$CXX $CXXFLAGS -fmodules-ts -I../../.. -x c++ -c ../../../lib_fm.ixx -o lib_fm.o
+	$CXX $CXXFLAGS -fmodules-ts -c ../import.cpp -o import.o
+fi
+$CXX $CXXFLAGS lib_fm.o import.o -o import -ldl
+echo "== module"
+./import
@@ -0,0 +1,68 @@
+// host.cpp : loads the test plugin and checks lazy binding, signature checks, close() and cross-library identity.
+// usage: host <path to the plugin>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include "shared.hpp"
+using namespace lib_fm;
+
+struct test_plugin;
+typedef plugin<test_plugin> library;
+
+auto constexpr add = plugin_symbol<test_plugin, "add", int(int, int)>;
+auto constexpr scale = plugin_symbol<test_plugin, "scale", double(double)>;
+auto constexpr scale_as_float = plugin_symbol<test_plugin, "scale", float(float)>;
+auto constexpr missing = plugin_symbol<test_plugin, "missing", void()>;
+auto constexpr make_doubler = plugin_symbol<test_plugin, "make_doubler", unary()>;
+auto constexpr make_tripler = plugin_symbol<test_plugin, "make_tripler", unary()>;
+
+template<typename call_type>
+bool throws_plugin_error(call_type &&call) {
+	try {
+		call();
+	} catch ( plugin_error const & ) {
+		return true;
+	};
+	return false;
+};
+
+int main(int const argc, char const *const argv[]) {
+	assert(argc == 2);
+	assert(!library::open("./no_such_plugin.so") && !library::is_open());
+	assert(library::open(argv[1]) && library::is_open());
+
+	// lazy binding: nothing resolves at load, or when wrapped; the first call does
+	short_function<int(int, int)> const sum = add;
+	assert(!add.is_resolved() && !scale.is_resolved() && !make_doubler.is_resolved());
+	assert(sum(2, 3) == 5);
+	assert(add.is_resolved() && !scale.is_resolved());
+	assert(scale.resolve() && scale.is_resolved() && scale(2.0) == 3.0);
+
+	// a signature mismatch or a missing name never binds
+	assert(!scale_as_float.resolve() && !scale_as_float.is_resolved());
+	assert(throws_plugin_error([] { scale_as_float(1.0f); }));
+	assert(!missing.resolve() && throws_plugin_error([] { missing(); }));
+
+	// one manager per callable type across the boundary: equality and type recovery work both ways
+	{
+		unary const doubled = make_doubler(), tripled = make_tripler();
+		assert(doubled(4) == 8 && tripled(4) == 12);
+		assert(doubled == unary { doubler {} });
+		assert(tripled == unary { monostate_from<&triple> });
+		assert(doubled != tripled);
+		assert(doubled.target<doubler>() && !tripled.target<doubler>());
+		auto const pointer = tripled.target<int (*)(int)>();
+		assert(pointer && *pointer == &triple);
+	};
+
+	// close() unbinds every resolved symbol; calls then fail until the library is opened again
+	library::close();
+	assert(!library::is_open() && !add.is_resolved() && !scale.is_resolved());
+	assert(throws_plugin_error([&sum] { sum(1, 1); }));
+	assert(library::open(argv[1]));
+	assert(!add.is_resolved() && sum(1, 2) == 3 && add.is_resolved());
+	library::close();
+
+	std::cout << "plugin: ok\n";
+	return EXIT_SUCCESS;
+};
@@ -0,0 +1,15 @@
+// plugin.cpp : the test plugin; built as a shared library by run.sh.
+#include "shared.hpp"
+
+int add(int const a, int const b) { return a + b; };
+double scale(double const x) { return 1.5 * x; };
+unary make_doubler() { return doubler {}; };
+unary make_tripler() { return lib_fm::monostate_from<&triple>; };
+
+extern "C" LIB_FM_VISIBLE lib_fm::symbol_entry const lib_fm_symbol_table[] = {
+	lib_fm::export_symbol<&add>("add"),
+	lib_fm::export_symbol<&scale>("scale"),
+	lib_fm::export_symbol<&make_doubler>("make_doubler"),
+	lib_fm::export_symbol<&make_tripler>("make_tripler"),
+	{}
+};
@@ -0,0 +1,15 @@
+#!/bin/sh
+# builds the test plugin and its host twice, with default and with hidden symbol visibility, and runs the host on each.
+# usage: tests/plugin/run.sh	(CXX and CXXFLAGS are honoured)
+set -e
+cd "$(dirname "$0")"
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:-"-std=c++20 -O2 -g -Wall -Wextra -pthread"}
+for visibility in default hidden; do
+	out=build/$visibility
+	mkdir -p $out
+	$CXX $CXXFLAGS -fvisibility=$visibility -I../.. -fPIC -shared plugin.cpp -o $out/libtest_plugin.so
+	$CXX $CXXFLAGS -fvisibility=$visibility -I../.. -rdynamic host.cpp -o $out/host -ldl
+	echo "== plugin (-fvisibility=$visibility)"
+	./$out/host ./$out/libtest_plugin.so
+done
@@ -0,0 +1,13 @@
+// shared.hpp : the callable types both the test host and the test plugin instantiate short_function with.
+#ifndef TESTS_PLUGIN_SHARED_HPP
+#define TESTS_PLUGIN_SHARED_HPP
+#include "../../plugin_loader.hpp"
+#include "../../short_function.hpp"
+
+//! exported, so that under -fvisibility=hidden the instantiations on it are exported too
+struct LIB_FM_VISIBLE doubler { int operator()(int const x) const noexcept { return 2 * x; }; };
+LIB_FM_VISIBLE inline int triple(int const x) { return 3 * x; };
+
+typedef lib_fm::short_function<int(int)> unary;
+
+#endif // !TESTS_PLUGIN_SHARED_HPP
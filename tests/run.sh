@@ -0,0 +1,23 @@
+#!/bin/sh
+# builds every test in this directory with the host compiler and runs it, then every suite in a subdirectory with its own
+# run.sh; stops at the first failure.
+# usage: tests/run.sh [test or suite names...]	(CXX and CXXFLAGS are honoured)
+set -e
+cd "$(dirname "$0")"
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:-"-std=c++20 -O2 -g -Wall -Wextra -pthread"}
+export CXX CXXFLAGS
+mkdir -p build
+if [ $# -eq 0 ]; then
+	set -- $(ls *.cpp | sed 's/\.cpp$//') $(ls */run.sh | sed 's|/run\.sh$||')
+fi
+for name in "$@"; do
+	if [ -d "$name" ]; then
+		"./$name/run.sh"
+		continue
+	fi
+	$CXX $CXXFLAGS -I.. "$name.cpp" -o "build/$name" -ldl
+	echo "== $name"
+	"./build/$name"
+done
+echo "all passed"
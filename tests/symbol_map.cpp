@@ -0,0 +1,99 @@
+// symbol_map.cpp : the records of each short_function and monostate_from path, the perf map format, and trace event ids
+// resolved through write_symbol_map.
+#define LIB_FM_SYMBOL_MAP 1
+#define LIB_FM_TRACE 1
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../short_function.hpp"
+using namespace lib_fm;
+
+int volatile sink = 0;
+void first(int const x) { sink = x; };
+void widened(long const x) { sink = static_cast<int>(x); };
+struct counter { void add(int const x) { sink = x; }; };
+
+std::vector<symbol_record> records_at(void const *const address) {
+	auto records = symbol_map_entries();
+	std::erase_if(records, [address](symbol_record const &record) { return record.address != address; });
+	return records;
+};
+
+bool starts_with(std::string const &text, std::string const &prefix) { return text.compare(0, prefix.size(), prefix) == 0; };
+
+int main() {
+	counter object;
+	short_function<void(int)> const exact { monostate_from<&first> }, converted { monostate_from<&widened> };
+	short_function<void(counter &, int)> const method { monostate_from<&counter::add> };
+	short_function<void(int)> const lambda { [](int const x) { sink = x + 1; } };
+
+	// a thunk per call path that needs one; an exact free function is stored as is
+	assert(exact.to_ptr() == &first && records_at(detail::erased_address(&first)).empty());
+	std::pair<void const *, char const *> const thunks[] { { detail::erased_address(converted.to_ptr()), "free function" },
+		{ detail::erased_address(method.to_ptr()), "instance method" }, { detail::erased_address(lambda.to_ptr()), "empty object" } };
+	for ( auto const &[thunk, source] : thunks ) {
+		auto const records = records_at(thunk);
+		assert(records.size() == 1 && records[0].kind == symbol_kind::thunk && records[0].size > 0);
+		assert(starts_with(records[0].name, std::string { "short_function thunk [" } + source + "] "));
+	};
+	auto const member_thunk = static_cast<void (*)(counter &, int)>(monostate_from<&counter::add>);
+	auto const records = records_at(detail::erased_address(member_thunk));
+	assert(records.size() == 1 && starts_with(records[0].name, "monostate_from thunk [instance method] "));
+
+	// recorded once, however often created and called
+	auto const count = symbol_map_entries().size();
+	short_function<void(int)> const again { monostate_from<&widened> };
+	again(1);
+	assert(symbol_map_entries().size() == count);
+	member_thunk(object, 1);												// the first call through a monostate_from
+	monostate_from<&first>(1);												// records its target
+	assert(symbol_map_entries().size() == count + 2);
+	member_thunk(object, 2);
+	monostate_from<&first>(2);
+	assert(symbol_map_entries().size() == count + 2);
+	assert(records_at(&decltype(monostate_from<&first>)::target_function)[0].kind == symbol_kind::target);
+
+	// perf map: 'start size name', hex, thunks only
+	assert(write_perf_map("build/symbol_map.perf"));
+	std::ifstream perf { "build/symbol_map.perf" };
+	std::regex const line_format { "([0-9a-f]+) ([0-9a-f]+) (short_function|monostate_from) thunk \\[[a-z ]+\\] .+ as .+" };
+	std::size_t lines = 0;
+	for ( std::string line; std::getline(perf, line); ++lines ) {
+		std::smatch match;
+		assert(std::regex_match(line, match, line_format));
+		auto const address = reinterpret_cast<void const *>(std::stoull(match[1], nullptr, 16));
+		assert(records_at(address).size() == 1 && records_at(address)[0].kind == symbol_kind::thunk);
+	};
+	assert(lines == static_cast<std::size_t>(std::ranges::count(symbol_map_entries(), symbol_kind::thunk, &symbol_record::kind)));
+
+	// every trace event names a manager or target in the symbol map
+	trace_enable();
+	exact(1);
+	converted(2);
+	method(object, 3);
+	lambda(4);
+	monostate_from<&counter::add>(object, 5);
+	trace_enable(false);
+	std::ostringstream trace, symbols;
+	assert(trace_flush(trace) == 5);
+	write_symbol_map(symbols);
+	std::string const events = trace.str(), map = symbols.str();
+	std::regex const event_format { "\\{\"name\":\"([^\"]+)\",\"cat\":\"([a-z_]+)\"" };
+	std::size_t resolved = 0;
+	for ( std::sregex_iterator event { events.begin(), events.end(), event_format }, end; event != end; ++event, ++resolved ) {
+		std::string const kind = (*event)[2] == "short_function" ? "manager" : "target";
+		auto const at = map.find("{\"address\":\"" + (*event)[1].str() + "\"");
+		assert(at != std::string::npos);
+		assert(map.compare(map.find("\"kind\":\"", at) + 8, kind.size(), kind) == 0);
+	};
+	assert(resolved == 5);
+
+	std::cout << "symbol_map: ok (" << symbol_map_entries().size() << " records)\n";
+	return EXIT_SUCCESS;
+};
@@ -0,0 +1,129 @@
+// timer_wheel.cpp : every timer fires on exactly its expiry tick, across levels and past the span; stale and in-batch
+// cancellation; scheduling from a callback.
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <unordered_map>
+#include <vector>
+#include "../timer_wheel.hpp"
+using namespace lib_fm;
+
+typedef timer_wheel<4, 2> small_wheel;		// 16 slots x 2 levels: a span of 256 ticks, so parking is cheap to reach
+typedef small_wheel::tick_type tick_type;
+static_assert(small_wheel::span == 256);
+
+//! what the callbacks, which only get their id, look up
+small_wheel *wheel = nullptr;
+std::unordered_map<timer_id, tick_type> due;				// id -> the tick it must fire on
+std::vector<timer_id> fired;
+
+void check_tick(timer_id const id) {
+	auto const it = due.find(id);
+	assert(it != due.end());								// scheduled, not cancelled, not fired before
+	assert(wheel->now() == it->second);
+	due.erase(it);
+	fired.push_back(id);
+};
+
+timer_id schedule_checked(tick_type const delay) {
+	auto const id = wheel->schedule(delay, monostate_from<&check_tick>);
+	due[id] = wheel->now() + std::max<tick_type>(delay, 1);
+	return id;
+};
+
+void exact_ticks() {
+	small_wheel w;
+	wheel = &w;
+	std::mt19937_64 random { 7 };
+	std::uniform_int_distribution<tick_type> delay { 0, 5 * small_wheel::span };	// up to 5 spans: parked and re-cascaded
+	std::size_t scheduled = 0;
+	for ( tick_type round = 0; round < 20; ++round ) {		// scheduled at many different wheel positions
+		for ( int i = 0; i < 500; ++i )
+			schedule_checked(delay(random));
+		for ( tick_type const edge : { tick_type { 0 }, tick_type { 15 }, tick_type { 16 }, tick_type { 17 }, small_wheel::span - 1,
+				small_wheel::span, small_wheel::span + 1, 3 * small_wheel::span } )
+			schedule_checked(edge);							// the edges of the levels and of the span
+		scheduled += 508;
+		assert(w.size() == due.size());
+		w.advance(1 + round * 37);							// single and multi-tick advances
+	};
+	while ( !w.empty() )
+		w.advance(3);
+	assert(due.empty() && fired.size() == scheduled);
+	fired.clear();
+};
+
+void cancellation() {
+	small_wheel w;
+	wheel = &w;
+	assert(!w.cancel(timer_id::invalid) && !w.cancel(static_cast<timer_id>(12345)));	// never issued
+
+	auto const old = schedule_checked(5);
+	assert(w.advance(5) == 1 && !w.cancel(old));			// already fired
+	auto const reused = schedule_checked(5);				// takes the freed node, with a new generation
+	assert(reused != old && !w.cancel(old));				// the stale id doesn't alias it
+	assert(w.cancel(reused) && !w.cancel(reused));			// cancelled once only
+	due.erase(reused);
+	assert(w.advance(10) == 0 && w.empty());
+	fired.clear();
+};
+
+//! the first of a batch to fire cancels every other member of the batch, and itself, which has already fired
+std::vector<timer_id> batch;
+std::size_t cancelled_in_batch = 0;
+void cancel_batch(timer_id const id) {
+	assert(!wheel->cancel(id));
+	for ( auto const other : batch )
+		if ( other != id )
+			cancelled_in_batch += wheel->cancel(other);
+	fired.push_back(id);
+};
+
+void cancel_inside_batch() {
+	small_wheel w;
+	wheel = &w;
+	for ( int i = 0; i < 5; ++i )
+		batch.push_back(w.schedule(40, monostate_from<&cancel_batch>));	// one slot, one batch
+	auto const bystander = schedule_checked(41);
+	assert(w.advance(40) == 1 && fired.size() == 1 && cancelled_in_batch == 4);
+	assert(w.size() == 1 && w.advance(1) == 1 && fired.back() == bystander);
+	batch.clear();
+	fired.clear();
+};
+
+//! reschedules itself until it has fired 'generations' times; a delay of 0 lands on the next tick, not in this batch
+int generations = 0;
+void reschedule(timer_id const id) {
+	check_tick(id);
+	if ( --generations > 0 ) {
+		auto const next = wheel->schedule(generations % 3 == 0 ? 0 : generations * 7, monostate_from<&reschedule>);
+		due[next] = wheel->now() + std::max<tick_type>(generations % 3 == 0 ? 0 : generations * 7, 1);
+	};
+};
+
+void schedule_from_callback() {
+	small_wheel w;
+	wheel = &w;
+	generations = 60;										// delays up to 413 ticks: some cross the span from a callback
+	auto const first = w.schedule(1, monostate_from<&reschedule>);
+	due[first] = 1;
+	std::size_t total = 0;
+	while ( !w.empty() ) {
+		auto const n = w.advance(1);
+		assert(n <= 1);										// a timer scheduled by a callback never fires in the same batch
+		total += n;
+	};
+	assert(total == 60 && generations == 0 && due.empty());
+	fired.clear();
+};
+
+int main() {
+	exact_ticks();
+	cancellation();
+	cancel_inside_batch();
+	schedule_from_callback();
+	std::cout << "timer_wheel: ok\n";
+	return EXIT_SUCCESS;
+};
@@ -0,0 +1,101 @@
+// trace.cpp : one record per call on each path, ring bounds, and flushing concurrently with a writer yields only whole,
+// in-order records.
+#define LIB_FM_TRACE 1
+#define LIB_FM_TRACE_CAPACITY 64
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include "../trace.hpp"
+#include "../short_function.hpp"
+using namespace lib_fm;
+
+int volatile sink = 0;
+void first(int const x) { sink = x; };
+void second(int const x) { sink = -x; };
+void widened(long const x) { sink = static_cast<int>(x); };
+struct counter { void add(int const x) { sink = x; }; };
+
+std::string name_of(void const *const id) {
+	std::ostringstream out;
+	out << id;
+	return out.str();
+};
+
+std::size_t flush_count() {
+	std::ostringstream out;
+	return trace_flush(out);
+};
+
+int main() {
+	flush_count();
+	assert(!trace_enabled());
+	monostate_from<&first>(1);
+	assert(flush_count() == 0);									// off: nothing recorded
+
+	trace_enable();
+	for ( int i = 0; i < 10; ++i )
+		monostate_from<&first>(i);
+	assert(flush_count() == 10);
+	assert(flush_count() == 0);									// already flushed
+
+	// a short_function holding a monostate_from: its hook only, whether the target is called as is, converted or as a member
+	counter object;
+	short_function<void(int)> const exact { monostate_from<&first> }, converted { monostate_from<&widened> };
+	short_function<void(counter &, int)> const method { monostate_from<&counter::add> };
+	for ( int i = 0; i < 10; ++i ) {
+		exact(i);
+		converted(i);
+		method(object, i);
+	};
+	assert(flush_count() == 30);
+	exact.to_ptr()(1);
+	converted.to_ptr()(1);
+	method.to_ptr()(object, 1);
+	assert(flush_count() == 0);									// bypassed
+	static_cast<void (*)(counter &, int)>(monostate_from<&counter::add>)(object, 1);
+	assert(flush_count() == 1);									// the member thunk of monostate_from itself
+	for ( int i = 0; i < 200; ++i )
+		monostate_from<&first>(i);
+	assert(flush_count() == LIB_FM_TRACE_CAPACITY - 1);			// the slot next in line may be mid-write: never read
+
+	// a writer alternating two targets while this thread flushes: every record has a known name, and each thread's
+	// records come out in start order
+	std::string const names[] {
+		"\"name\":\"" + name_of(&decltype(monostate_from<&first>)::target_function) + "\"",
+		"\"name\":\"" + name_of(&decltype(monostate_from<&second>)::target_function) + "\"" };
+	std::atomic<bool> done { false };
+	std::thread writer { [&done] {
+		for ( int i = 0; i < 2'000'000; ++i )
+			if ( i & 1 )
+				monostate_from<&second>(i);
+			else
+				monostate_from<&first>(i);
+		done = true;
+	} };
+	std::size_t records = 0;
+	while ( !done ) {
+		std::ostringstream out;
+		records += trace_flush(out);
+		std::istringstream in { out.str() };
+		double last_start = 0;
+		for ( std::string line; std::getline(in, line); ) {
+			auto const ts = line.find("\"ts\":");
+			if ( ts == std::string::npos )
+				continue;
+			assert(line.find(names[0]) != std::string::npos || line.find(names[1]) != std::string::npos);
+			double const start = std::stod(line.substr(ts + 5));
+			assert(start >= last_start);
+			last_start = start;
+		};
+	};
+	writer.join();
+	records += flush_count();
+	assert(records > 0 && records <= 2'000'000);
+	trace_enable(false);
+	std::cout << "trace: ok (" << records << " of 2000000 records flushed concurrently)\n";
+	return EXIT_SUCCESS;
+};
@@ -0,0 +1,229 @@
+#ifndef TIMER_WHEEL_HPP
+#define TIMER_WHEEL_HPP
+//! @file timer_wheel.hpp
+//! @brief a header only hierarchical timing wheel storing its callbacks as *short_function*s.
+//!
+//! each pending timer is a pool node holding a pointer-sized 'short_function<void(timer_id)>' and an intrusive, index based
+//! double link; no allocation happens per timer once the pool has grown to the working set. schedule, cancel and per-tick
+//! advance are O(1); timers far in the future live in coarser levels and cascade down as the wheel turns. expired timers are
+//! fired in batches, one slot at a time.
+//! since a *short_function* carries no state, the callback receives the **timer_id** it was scheduled under and is expected
+//! to find its context through it (e.g. a connection table indexed by the same id).
+//!
+//! Example:
+//! @code
+//!	lib_fm::timer_wheel<> wheel;
+//!	auto const id = wheel.schedule(30, monostate_from<&on_idle_timeout>);
+//!	wheel.cancel(id);		// O(1), stale ids are rejected
+//!	wheel.advance(elapsed);	// fires every timer due within 'elapsed' ticks
+//! @endcode
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <stdexcept>
+#include "short_function.hpp"
+
+namespace lib_fm {
+
+	//! @brief handle of a scheduled timer. combines the pool index with a generation counter, so stale handles never alias.
+	enum class timer_id : std::uint64_t { invalid = ~std::uint64_t{} };
+
+#	include "detail/d_timer_wheel.hpp"
+
+	//! @brief a hierarchical timing wheel of **levels** levels, each with 2^**slot_bits** slots.
+	//! the wheel spans 2^(slot_bits*levels) ticks; longer delays are parked in the last level and re-cascaded until due.
+	//! @tparam slot_bits log2 of the number of slots per level
+	//! @tparam levels number of wheel levels
+	template<std::size_t slot_bits = 8, std::size_t levels = 4>
+		requires(slot_bits > 0 && levels > 0 && slot_bits * levels < 64)
+	class timer_wheel {
+	public:
+		typedef short_function<void(timer_id)> callback_type;
+		typedef std::uint64_t tick_type;
+
+		std::size_t static constexpr slot_count = std::size_t{ 1 } << slot_bits;
+		tick_type static constexpr span = tick_type{ 1 } << (slot_bits * levels);
+
+	private:
+		typedef detail::timer_node<callback_type, tick_type> node_type;
+		using index_type = typename node_type::index_type;
+		index_type static constexpr nil = node_type::nil;
+		index_type static constexpr expiring_slot = static_cast<index_type>(slot_count * levels);
+		index_type static constexpr free_slot = expiring_slot + 1;
+
+	public:
+		//! @brief memory held by each pending (or pooled) timer
+		std::size_t static constexpr bytes_per_timer = sizeof(node_type);
+
+		constexpr timer_wheel() noexcept { heads.fill(nil); };
+		timer_wheel(timer_wheel const &) = delete;
+		timer_wheel &operator=(timer_wheel const &) = delete;
+
+		//! @brief grows the node pool up front, so that scheduling up to **count** timers never allocates.
+		void reserve(std::size_t const count) { nodes.reserve(count); };
+
+		//! @brief schedules **fn** to be called once, **delay** ticks from now.
+		//! @param delay number of ticks to wait; 0 is treated as 1, the next call to *advance*.
+		//! @param fn the callback; receives the returned id.
+		//! @return the id used to cancel the timer.
+		timer_id schedule(tick_type const delay, callback_type const fn) {
+			index_type const idx = acquire();
+			node_type &node = nodes[idx];
+			node.callback = fn;
+			node.expiry = current + (delay ? delay : 1);
+			place(idx);
+			++pending;
+			return node_type::make_id(idx, node.generation);
+		}; // !schedule
+
+		//! @brief cancels a pending timer.
+		//! @return **true**, iff the timer was pending; **false**, if it already fired, was cancelled or never existed.
+		bool cancel(timer_id const id) noexcept {
+			index_type const idx = node_type::index_of(id);
+			if ( idx >= nodes.size() )
+				return false;
+			node_type &node = nodes[idx];
+			if ( node.slot == free_slot || node.generation != node_type::generation_of(id) )
+				return false;
+			unlink(idx);
+			release(idx);
+			--pending;
+			return true;
+		}; // !cancel
+
+		//! @brief turns the wheel **ticks** times, firing expired timers slot by slot.
+		//! callbacks may schedule and cancel timers, including the ones expiring in the same batch.
+		//! @return the number of callbacks invoked.
+		std::size_t advance(tick_type ticks = 1) {
+			std::size_t fired = 0;
+			while ( ticks-- ) {
+				++current;
+				if ( !pending ) {		// nothing to fire or cascade; just catch up
+					current += ticks;
+					break;
+				};
+				auto idx = static_cast<index_type>(current & slot_mask);
+				if ( !idx )
+					cascade();
+				fired += expire(idx);
+			}; // !while ticks
+			return fired;
+		}; // !advance
+
+		//! @brief number of ticks the wheel has turned since construction
+		tick_type now() const noexcept { return current; };
+		//! @brief number of pending timers
+		std::size_t size() const noexcept { return pending; };
+		bool empty() const noexcept { return !pending; };
+		//! @brief number of pooled nodes, pending or free
+		std::size_t capacity() const noexcept { return nodes.size(); };
+
+	private:
+		tick_type static constexpr slot_mask = slot_count - 1;
+
+		index_type acquire() {
+			if ( free_list != nil ) {
+				index_type const idx = free_list;
+				free_list = nodes[idx].next;
+				return idx;
+			};
+			if ( nodes.size() >= nil )
+				throw std::length_error{ "timer_wheel: too many pending timers" };
+			nodes.emplace_back();
+			return static_cast<index_type>(nodes.size() - 1);
+		}; // !acquire
+
+		void release(index_type const idx) noexcept {
+			node_type &node = nodes[idx];
+			node.callback = {};
+			node.slot = free_slot;
+			++node.generation;
+			node.next = free_list;
+			free_list = idx;
+		}; // !release
+
+		void link(index_type const idx, index_type const slot) noexcept {
+			node_type &node = nodes[idx];
+			node.slot = slot;
+			node.prev = nil;
+			node.next = heads[slot];
+			if ( node.next != nil )
+				nodes[node.next].prev = idx;
+			heads[slot] = idx;
+		}; // !link
+
+		void unlink(index_type const idx) noexcept {
+			node_type &node = nodes[idx];
+			if ( node.prev != nil )
+				nodes[node.prev].next = node.next;
+			else
+				heads[node.slot] = node.next;
+			if ( node.next != nil )
+				nodes[node.next].prev = node.prev;
+		}; // !unlink
+
+		//! picks the level by distance to expiry and the slot by the expiry bits of that level
+		void place(index_type const idx) noexcept {
+			tick_type const expiry = nodes[idx].expiry;
+			tick_type const delta = expiry - current;
+			if ( delta >= span ) {	// park in the last level, re-cascaded until due:
+				auto constexpr level = levels - 1;
+				tick_type const parked = current + span - 1;
+				link(idx, static_cast<index_type>(level * slot_count + ((parked >> (slot_bits * level)) & slot_mask)));
+				return;
+			};
+			std::size_t level = 0;
+			while ( delta >> (slot_bits * (level + 1)) )
+				++level;
+			link(idx, static_cast<index_type>(level * slot_count + ((expiry >> (slot_bits * level)) & slot_mask)));
+		}; // !place
+
+		//! moves the due slot of each coarser level down, as long as the finer level has wrapped around
+		void cascade() noexcept {
+			for ( std::size_t level = 1; level < levels; ++level ) {
+				auto const idx = static_cast<index_type>((current >> (slot_bits * level)) & slot_mask);
+				auto &head = heads[level * slot_count + idx];
+				for ( index_type node = std::exchange(head, nil); node != nil; ) {
+					index_type const next = nodes[node].next;
+					place(node);
+					node = next;
+				};
+				if ( idx )
+					break;
+			}; // !for level
+		}; // !cascade
+
+		//! detaches a level-0 slot into the expiring list and fires it; the list stays linked, so callbacks can cancel its members
+		std::size_t expire(index_type const slot) {
+			std::size_t fired = 0;
+			index_type head = std::exchange(heads[slot], nil);
+			if ( head == nil )
+				return fired;
+			heads[expiring_slot] = head;
+			for ( index_type idx = head; idx != nil; idx = nodes[idx].next )
+				nodes[idx].slot = expiring_slot;
+
+			while ( (head = heads[expiring_slot]) != nil ) {
+				unlink(head);
+				auto const callback = nodes[head].callback;
+				auto const id = node_type::make_id(head, nodes[head].generation);
+				release(head);
+				--pending;
+				++fired;
+				callback(id);	// may reallocate 'nodes'
+			}; // !while expiring
+			return fired;
+		}; // !expire
+
+		std::vector<node_type> nodes;
+		std::array<index_type, slot_count * levels + 1> heads{};
+		index_type free_list = nil;
+		std::size_t pending = 0;
+		tick_type current = 0;
+	}; // !timer_wheel
+}; // !lib_fm
+
+#endif // !TIMER_WHEEL_HPP